@@ -0,0 +1,130 @@
+/**
+ * @file AudioSystem.h
+ * @author Ian Codding II
+ * @brief Sound effects from a fixed voice pool, music streamed in the background
+ * @version 1.0
+ * @date 2025-12-16
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * HOW IT WORKS:
+ * - load() decodes every effect into an sf::SoundBuffer once (from
+ *   assets/audio/<name>.wav, or a short synthesized sound when the file
+ *   is missing), so nothing is decoded during play
+ * - VOICE_COUNT sf::Sound voices are created up front; one sf::Sound per
+ *   event (every 0.1 s while firing) would allocate and run out of
+ *   OpenAL sources
+ * - trigger() (game thread) only bumps a counter; endTick() pushes one
+ *   command per sound triggered this tick into a lock-free SPSC ring,
+ *   so ten mushroom hits in one tick are one sound, not ten in phase
+ * - The audio thread drains the ring every MIX_INTERVAL_MS: a free
+ *   voice plays the sound, otherwise the oldest voice of the lowest
+ *   priority below (or equal to) the new sound's is stolen; if every
+ *   voice is busy with something more important the sound is dropped
+ * - Music is an sf::Music, which streams from its own SFML thread; it is
+ *   opened and controlled on the audio thread as well, so the game
+ *   thread never waits on file I/O or OpenAL (setMusicPaused() only
+ *   sets a flag)
+ */
+
+#ifndef AUDIO_SYSTEM_H
+#define AUDIO_SYSTEM_H
+
+#include "SpscRing.h"
+#include <SFML/Audio.hpp>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+/**
+ * @brief Every sound effect the game plays
+ */
+enum class SoundId : std::uint8_t {
+    Shoot,
+    MushroomHit,
+    EnemyHit,
+    CentipedeHit,
+    PlayerHit,
+    Count
+};
+
+class AudioSystem {
+public:
+    AudioSystem();
+    ~AudioSystem();
+
+    AudioSystem(const AudioSystem&) = delete;
+    AudioSystem& operator=(const AudioSystem&) = delete;
+
+    /**
+     * @brief Decode (or synthesize) every sound buffer; call before start()
+     */
+    void load();
+
+    /**
+     * @brief Start the audio thread and the music
+     */
+    void start();
+
+    /**
+     * @brief Stop every voice and the music, join the audio thread
+     */
+    void stop();
+
+    bool isRunning() const { return running; }
+
+    // ===== GAME THREAD (never blocks, never allocates) =====
+
+    /**
+     * @brief Ask for a sound this tick
+     */
+    void trigger(SoundId sound);
+
+    /**
+     * @brief Send this tick's sounds to the audio thread
+     */
+    void endTick();
+
+    /**
+     * @brief Pause or resume the music (effects finish on their own)
+     */
+    void setMusicPaused(bool paused);
+
+    static constexpr std::size_t VOICE_COUNT = 16;
+    static constexpr int MIX_INTERVAL_MS = 5;
+    static constexpr unsigned SAMPLE_RATE = 22050;
+
+private:
+    static constexpr std::size_t SOUND_COUNT = static_cast<std::size_t>(SoundId::Count);
+
+    struct Voice {
+        sf::Sound sound;
+        int priority = 0;
+        std::uint64_t started = 0;   // Order of play() calls, oldest is stolen first
+    };
+
+    void audioLoop();
+    void play(SoundId sound);
+    Voice* pickVoice(int priority);
+    void synthesize(SoundId sound);
+
+    std::array<sf::SoundBuffer, SOUND_COUNT> buffers;
+    SpscRing<SoundId, 128> ring;        // Sounds to start, game thread -> audio thread
+    std::thread thread;
+    std::atomic<bool> running;
+    std::atomic<bool> musicPaused;      // Applied by the audio thread
+
+    // Game-thread state
+    std::array<bool, SOUND_COUNT> pending;   // Triggered this tick
+
+    // Audio-thread state
+    std::array<Voice, VOICE_COUNT> voices;
+    sf::Music music;
+    bool haveMusic;
+    std::uint64_t playCount;
+    std::uint64_t stolenCount;
+    std::uint64_t droppedCount;
+};
+
+#endif // AUDIO_SYSTEM_H
@@ -0,0 +1,94 @@
+/**
+ * @file ButtonGroup.h
+ * @author Ian Codding II
+ * @brief Mouse hit-testing for the buttons of one screen
+ * @version 1.0
+ * @date 2025-12-10
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * HOW IT WORKS:
+ * - The group keeps the screen rectangle of each button, computed once
+ *   when the button is added (refreshRects() after moving one)
+ * - MouseMoved events only remember the newest cursor position; the
+ *   hit-test runs once per frame in flush(), no matter how many moves
+ *   arrived in between
+ * - The cursor position comes from the events themselves; the OS is only
+ *   asked (once) when the group has no position yet, e.g. right after a
+ *   screen or dialog opens
+ * - Only the button that was left and the button that was entered get a
+ *   state change, every other button is left alone
+ * - Clicks flush pending moves first, so they see the same hover state
+ *   the user saw
+ *
+ * The group does not own its buttons; the screen still creates, draws
+ * and deletes them.
+ */
+
+#ifndef BUTTON_GROUP_H
+#define BUTTON_GROUP_H
+
+#include "button.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+class ButtonGroup {
+public:
+    ButtonGroup();
+
+    /**
+     * @brief Add a button (its current rectangle is cached)
+     */
+    void add(Button* button);
+
+    /**
+     * @brief Forget every button (call before deleting them)
+     */
+    void clear();
+
+    /**
+     * @brief Recompute the cached rectangles after moving or resizing a button
+     */
+    void refreshRects();
+
+    /**
+     * @brief Feed one event to the group
+     *
+     * @return The button a left click landed on, or nullptr
+     */
+    Button* handleEvent(const sf::Event& event, const sf::RenderWindow& window);
+
+    /**
+     * @brief Hit-test the newest cursor position once
+     *
+     * Call once per frame after all events were handled.
+     *
+     * @return true if a button changed state since the last flush(),
+     *         here or in handleEvent() (clicks, the cursor leaving)
+     */
+    bool flush(const sf::RenderWindow& window);
+
+    /**
+     * @brief Forget the hover state and read the cursor again on the next flush()
+     *
+     * Call when the group becomes active again (e.g. a dialog closed), since
+     * it saw none of the mouse moves in between.
+     */
+    void resync();
+
+private:
+    int hitTest(sf::Vector2i pixel, const sf::RenderWindow& window) const;
+    void setHovered(int index);
+
+    std::vector<Button*> buttons;
+    std::vector<sf::FloatRect> rects;  // Same order as buttons, in default-view coordinates
+
+    int hoveredIndex;      // Button under the cursor, -1 for none
+    int pressedIndex;      // Button the left button went down on, -1 for none
+    sf::Vector2i cursor;   // Newest cursor position, in window pixels
+    bool cursorMoved;      // cursor changed since the last flush()
+    bool needsSample;      // No cursor position from events yet
+    bool changed;          // A button changed state since the last flush()
+};
+
+#endif // BUTTON_GROUP_H
@@ -14,6 +14,7 @@
 
 #include "animated_object.h"
 #include "grid.h"
+#include "World.h"
 #include <vector>
 #include <cmath>
 
@@ -28,20 +29,29 @@ public:
 
     ~Centipede();
     // Returns head position
-    sf::Vector2f getPosition() {return mPosition;};
+    sf::Vector2f getPosition() const {return mCentipedeVect.empty() ? mPosition : mCentipedeVect[0]->mSprite->getPosition();};
 
     
     void setPosition(sf::Vector2f position);
     
     void setScale(sf::Vector2i factor);
-    void move(float dt, Grid grid);
+    void move(float dt, Grid grid, const World& world);
     void fall();
-    void hit(const c_obj* part);
-    void hit(); // Simple hit
-    void update(float dt);
+    Centipede* hit(const c_obj* part);
+    bool empty() const {return mCentipedeVect.empty();};
+    bool contains(ecs::Entity part) const;
+
+    void saveState(SaveWriter& out) const;
+    static Centipede* loadState(SaveReader& in, sf::Texture& texture);
+    static constexpr std::size_t MAX_LENGTH = 256;   // Longest chain a save state may hold
+    void hashState(StateChecksum& sum, int chain) const;
+
     void draw(sf::RenderTarget& target,sf::RenderStates states) const;
 
 private:
+    void step(sf::Vector2f offset);
+    void promoteHead();
+
     struct segment {
         segment(anim_obj* sprite, std::string name) {
             mName = name;
@@ -59,6 +69,12 @@ private:
     float elapsedTime = 0.0;
     const float speed = 0.1;
     sf::Texture* mTexture;
+    sf::Vector2i mFactor;
+
+    // Per-chain heading, so chains can move independently of each other
+    VertDirection vertState = VertDirection::down;
+    HoriDirection horiState = HoriDirection::right;
+    bool diving = false;   // Hit a poisoned mushroom, heading for the bottom row
     
 };
 
@@ -0,0 +1,61 @@
+/**
+ * @file DebugOptions.h
+ * @author Ian Codding II
+ * @brief Command line switches for testing and profiling
+ * @version 1.0
+ * @date 2025-12-12
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Usage: ./centipede [--stress] [--cpu-log] [--latency-log] [--fps N] [--frame-stats]
+ *                    [--resume FILE] [--rewind] [--checksum FILE] [--seed N]
+ *                    [--world WxH]
+ *   --stress       Keep Game::STRESS_ENEMIES enemies alive at all times and
+ *                  make the player invulnerable
+ *   --cpu-log      Log the process CPU usage every few seconds
+ *   --latency-log  Log input-to-present latency every few seconds
+ *   --fps N        Target frame rate (default 60)
+ *   --frame-stats  Print frame-time percentiles on exit
+ *   --resume FILE  Suspend/resume: the first game starts from FILE (which is
+ *                  then deleted) and a game still running on exit is
+ *                  saved to FILE
+ *   --rewind       Record the last seconds of play; hold Backspace in a
+ *                  game to rewind, release to play on from there
+ *   --checksum FILE  Log every tick's state checksum to FILE (rewritten by
+ *                  each new game) and run ticks at a fixed 1/fps, so two
+ *                  runs can be compared with tools/checksum_diff
+ *   --seed N       Seed rand() with N instead of the clock (same mushrooms)
+ *   --world WxH    Playfield W fields wide and H fields tall (a field is
+ *                  the default 950x720 playfield; default 1x1). The
+ *                  camera follows the player and far chunks are packed.
+ */
+
+#ifndef DEBUG_OPTIONS_H
+#define DEBUG_OPTIONS_H
+
+#include <string>
+
+/**
+ * @struct DebugOptions
+ * @brief Parsed once in main() and handed to the systems that use it
+ */
+struct DebugOptions {
+    bool stress = false;
+    bool cpuLog = false;
+    bool latencyLog = false;
+    bool frameStats = false;
+    bool rewind = false;
+    unsigned frameRate = 60;
+    std::string resumeFile;   // Empty = no suspend/resume
+    std::string checksumFile; // Empty = checksums are not logged
+    unsigned seed = 0;        // 0 = seed rand() from the clock
+    unsigned worldWidth = 1;  // Playfield size, in default fields
+    unsigned worldHeight = 1;
+
+    /**
+     * @brief Read switches from the command line, warn about unknown ones
+     */
+    static DebugOptions parse(int argc, char* argv[]);
+};
+
+#endif // DEBUG_OPTIONS_H
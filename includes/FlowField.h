@@ -0,0 +1,49 @@
+/**
+ * @file    FlowField.h
+ * @author  Balin Becker
+ * @brief   Precomputed centipede head moves per grid cell
+ * @date    2025-12-12
+ *
+ * A centipede head one cell in size only ever looks at the cell ahead of
+ * it: if that cell holds a mushroom or is off the grid, the head drops
+ * (or rises) and turns, otherwise it steps forward. So the next move of
+ * a head is a pure function of (cell, horizontal direction, vertical
+ * direction) and the occupancy of one neighbour, and can be stored in a
+ * table of four bytes per cell.
+ *
+ * A poisoned (super) mushroom ahead gives Dive instead of a turn.
+ *
+ * When a cell changes, only the two cells whose look-ahead is that cell
+ * change (the one to its left heading right, the one to its right
+ * heading left).
+ */
+
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include <cstdint>
+#include <vector>
+
+class FlowField {
+public:
+    enum class Move : std::uint8_t {Left, Right, Down, Up, Dive};
+
+    FlowField(int columns, int rows);
+
+    /**
+     * @brief Next move of a head in cell, going right/left and down/up
+     */
+    Move next(int cell, bool right, bool down) const {
+        return mMoves[cell * 4 + (right ? 2 : 0) + (down ? 1 : 0)];
+    };
+
+    void cellChanged(int column, int row, bool occupied, bool poisoned = false);
+
+private:
+    void setAhead(int column, int row, bool right, bool blocked, bool poisoned = false);
+
+    int mColumns;
+    std::vector<Move> mMoves;   // [cell][right][down]
+};
+
+#endif
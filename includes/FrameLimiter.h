@@ -0,0 +1,104 @@
+/**
+ * @file FrameLimiter.h
+ * @author Ian Codding II
+ * @brief Precise frame rate limiting (sleep, then spin) and frame-time statistics
+ * @version 1.0
+ * @date 2025-12-15
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * HOW IT WORKS:
+ * - sf::sleep / setFramerateLimit wake up whenever the OS scheduler gets
+ *   round to it, which on Linux can be a millisecond or more late
+ * - waitUntil() sleeps until SPIN_US before the deadline, then spins on
+ *   the monotonic (steady) clock for the rest, so frames end within a
+ *   few microseconds of the deadline for the cost of < SPIN_US of CPU
+ * - Every frame time goes into a FrameTimeHistogram; print() reports
+ *   p50 / p95 / p99 / max (main.cpp dumps them on exit with --frame-stats)
+ */
+
+#ifndef FRAME_LIMITER_H
+#define FRAME_LIMITER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class FrameTimeHistogram
+ * @brief Frame times in BUCKET_US buckets up to MAX_TRACKED_US, exact max
+ */
+class FrameTimeHistogram {
+public:
+    FrameTimeHistogram();
+
+    void add(std::uint64_t micros);
+    void clear();
+
+    std::uint64_t count() const { return samples; }
+    std::uint64_t max() const { return longest; }
+
+    /**
+     * @brief Upper edge of the bucket holding the given fraction of frames
+     * @param fraction 0.5 for p50, 0.99 for p99, ...
+     */
+    std::uint64_t percentile(double fraction) const;
+
+    /**
+     * @brief Log p50 / p95 / p99 / max in milliseconds
+     */
+    void print(const std::string& label) const;
+
+    static constexpr std::uint64_t BUCKET_US = 50;
+    static constexpr std::uint64_t MAX_TRACKED_US = 200000;   // Longer frames share the last bucket
+
+private:
+    std::vector<std::uint32_t> buckets;
+    std::uint64_t samples;
+    std::uint64_t longest;
+};
+
+/**
+ * @class FrameLimiter
+ * @brief Ends each frame on a fixed schedule and records how long frames took
+ */
+class FrameLimiter {
+public:
+    explicit FrameLimiter(unsigned hz = 60);
+
+    void setRate(unsigned hz);
+    unsigned getRate() const { return rate; }
+
+    /**
+     * @brief Block until the end of this frame, then record its length
+     */
+    void wait();
+
+    /**
+     * @brief Start a new schedule from now (after a deliberate pause, e.g. waitEvent())
+     */
+    void restart();
+
+    const FrameTimeHistogram& getFrameTimes() const { return frameTimes; }
+
+    /**
+     * @brief Sleep, then spin, until a steady-clock time in microseconds
+     */
+    static void waitUntil(std::uint64_t micros);
+
+    /**
+     * @brief Steady clock in microseconds
+     */
+    static std::uint64_t nowMicros();
+
+    static constexpr std::uint64_t SPIN_US = 500;   // Spun, not slept, before a deadline
+
+private:
+    unsigned rate;
+    std::uint64_t period;
+    std::uint64_t nextFrame;
+    std::uint64_t lastFrame;
+    FrameTimeHistogram frameTimes;
+};
+
+#endif // FRAME_LIMITER_H
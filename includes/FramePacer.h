@@ -0,0 +1,142 @@
+/**
+ * @file FramePacer.h
+ * @author Ian Codding II
+ * @brief Schedules simulation and rendering just in time for each present
+ * @version 1.0
+ * @date 2025-12-14
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * HOW IT WORKS:
+ * - Presents are planned on a fixed grid: present k at base + k * period
+ * - The render thread sleeps FIRST, until the latest moment it can start
+ *   and still finish by the present (predicted render cost + margin),
+ *   then grabs the newest snapshot, draws, displays and waits for the GPU
+ *   (glFinish), so no frames queue up in the driver
+ * - The simulation sleeps until its predicted cost before that render
+ *   latch, then samples input and simulates, so the frame that reaches
+ *   the screen was simulated from input read moments before
+ * - Costs are predicted as the slowest of the last COST_WINDOW frames,
+ *   so one slow frame raises the prediction right away
+ * - A present that can no longer be made is skipped, not chased
+ *
+ * The old order (simulate, draw, display, then sleep in
+ * setFramerateLimit) sampled input up to a whole frame before the image
+ * reached the screen.
+ *
+ * Sleeps use FrameLimiter::waitUntil() (sleep, then spin), and the time
+ * between presents is kept in a FrameTimeHistogram.
+ *
+ * LATENCY LOG (--latency-log):
+ * The render thread logs the time from a keyboard change being sampled
+ * (see InputSystem) to the present of the first frame simulated with it,
+ * every LOG_SECONDS.
+ */
+
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include "FrameLimiter.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+class FramePacer {
+public:
+    explicit FramePacer(unsigned presentHz = 60);
+
+    /**
+     * @brief Start a new schedule from now (before the render thread starts)
+     */
+    void reset();
+
+    unsigned getRate() const { return rate; }
+
+    // ===== RENDER THREAD =====
+
+    /**
+     * @brief Sleep until it is time to start drawing the next present
+     */
+    void waitToRender();
+
+    /**
+     * @brief Call after display() returned and the GPU finished
+     * @param inputTime Newest input change the drawn frame was simulated with (0 = none)
+     */
+    void framePresented(std::uint64_t inputTime);
+
+    /**
+     * @brief Nothing to draw this time; move on to the next present
+     */
+    void skipFrame();
+
+    /**
+     * @brief Time between presents (read only while the render thread is stopped)
+     */
+    const FrameTimeHistogram& getFrameTimes() const { return presentIntervals; }
+
+    // ===== SIMULATION THREAD =====
+
+    /**
+     * @brief Sleep until the simulation has to start to make the next render latch
+     */
+    void waitToSimulate();
+
+    /**
+     * @brief Call once the tick's snapshot has been published
+     */
+    void simulationDone();
+
+    /**
+     * @brief Log input-to-present latency from the render thread
+     */
+    void setLatencyLog(bool enabled) { latencyLog = enabled; }
+
+    /**
+     * @brief Steady clock in microseconds (same clock as InputSystem)
+     */
+    static std::uint64_t nowMicros() { return FrameLimiter::nowMicros(); }
+
+    static constexpr std::uint64_t MARGIN_US = 1000;   // Slack for sleep overshoot
+    static constexpr std::size_t COST_WINDOW = 32;     // Frames in the cost prediction
+    static constexpr double LOG_SECONDS = 5.0;
+
+private:
+    /**
+     * @brief Recent durations; predicts the next one as the slowest of them
+     */
+    struct CostWindow {
+        std::uint32_t samples[COST_WINDOW] = {};
+        std::size_t next = 0;
+
+        void add(std::uint64_t micros);
+        std::uint64_t predict() const;
+    };
+
+    std::uint64_t presentTime(std::uint64_t index) const { return base + index * period; }
+    std::uint64_t renderLatch(std::uint64_t index) const;
+
+    unsigned rate;
+    std::uint64_t period;                        // Microseconds between presents
+    std::uint64_t base;                          // Time of present 0 (set by reset())
+    std::atomic<std::uint64_t> renderIndex;      // Present the render thread works towards
+    std::atomic<std::uint64_t> predictedRender;  // Microseconds, written by the render thread
+
+    // Render thread only
+    CostWindow renderCosts;
+    std::uint64_t renderStart;
+    std::uint64_t lastPresent;                   // 0 until the first present after reset()
+    FrameTimeHistogram presentIntervals;
+    bool latencyLog;
+    std::uint64_t loggedInput;                   // Input change already measured
+    std::uint64_t latencyTotal, latencyMax, latencySamples, skippedFrames;
+    std::uint64_t logStart;
+
+    // Simulation thread only
+    CostWindow simCosts;
+    std::uint64_t simTarget;                     // Present the last tick was aimed at
+    bool simStarted;
+    std::uint64_t simStart;
+};
+
+#endif // FRAME_PACER_H
@@ -0,0 +1,138 @@
+/**
+ * @file FrameSnapshot.h
+ * @author Ian Codding II
+ * @brief Plain data describing one frame for the render thread
+ * @version 1.0
+ * @date 2025-12-08
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The simulation fills a FrameSnapshot, hands it to the RenderThread
+ * and never touches it again, so the render thread can read it without
+ * locks. Everything in here is copied values - no pointers into game
+ * objects that the simulation might delete.
+ *
+ * Mushrooms are not in the sprite list. The render thread keeps them
+ * pre-drawn in one layer texture per world chunk, so a snapshot only
+ * carries the mushroom changes the render thread has not acknowledged
+ * yet (see MushroomAck).
+ */
+
+#ifndef FRAME_SNAPSHOT_H
+#define FRAME_SNAPSHOT_H
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct SpriteInstance
+ * @brief Transform and atlas rectangle of one sprite (no rotation)
+ */
+struct SpriteInstance {
+    sf::Vector2f position;
+    sf::Vector2f origin;      // In local (unscaled) pixels, like sf::Sprite
+    sf::Vector2f scale;
+    sf::IntRect textureRect;  // Region of the atlas
+
+    /**
+     * @brief Copy the parts of a sprite the render thread needs
+     */
+    static SpriteInstance fromSprite(const sf::Sprite& sprite) {
+        SpriteInstance instance;
+        instance.position = sprite.getPosition();
+        instance.origin = sprite.getOrigin();
+        instance.scale = sprite.getScale();
+        instance.textureRect = sprite.getTextureRect();
+        return instance;
+    }
+
+    /**
+     * @brief World-space rectangle covered by the sprite
+     */
+    sf::FloatRect bounds() const {
+        float x1 = position.x - origin.x * scale.x;
+        float y1 = position.y - origin.y * scale.y;
+        float x2 = x1 + textureRect.width * scale.x;
+        float y2 = y1 + textureRect.height * scale.y;
+        return sf::FloatRect(std::min(x1, x2), std::min(y1, y2), std::abs(x2 - x1), std::abs(y2 - y1));
+    }
+};
+
+/**
+ * @struct ParticleInstance
+ * @brief One particle, drawn as an untextured square centred on position
+ */
+struct ParticleInstance {
+    sf::Vector2f position;
+    float size = 0.0f;
+    sf::Color color;          // Alpha already faded by remaining life
+};
+
+/**
+ * @struct MushroomChange
+ * @brief One mushroom spawned, changed look, or removed
+ */
+struct MushroomChange {
+    std::uint64_t sequence = 0;  // Increases by one per change within a session
+    std::uint32_t cell = 0;      // Which world cell
+    std::uint32_t chunk = 0;     // Which world chunk holds that cell
+    bool removed = false;
+    SpriteInstance sprite;       // New look (unused when removed)
+};
+
+/**
+ * @struct MushroomAck
+ * @brief Last mushroom change the render thread has drawn into its layer
+ *          A session other than the game's means "nothing applied yet"
+ */
+struct MushroomAck {
+    std::uint32_t session = 0;
+    std::uint64_t sequence = 0;
+};
+
+/**
+ * @struct FrameSnapshot
+ * @brief Everything needed to draw one gameplay frame
+ */
+struct FrameSnapshot {
+    const sf::Texture* atlas = nullptr;   // Shared sprite atlas (outlives the render thread)
+    std::vector<SpriteInstance> sprites;  // Drawn in order, back to front, over the mushroom layer
+    std::vector<ParticleInstance> particles;  // Drawn over the sprites in one vertex array
+
+    sf::View view;                        // Camera, in world coordinates (HUD uses the default view)
+    sf::Vector2f worldOrigin;             // Top-left corner of chunk 0
+    float chunkPixels = 0.0f;             // Chunk edge, in world pixels
+    int chunkColumns = 1;                 // Chunks per world row
+
+    std::uint32_t mushroomSession = 0;           // Changes from another session reset the layer
+    std::vector<MushroomChange> mushroomChanges; // Every change after the render thread's ack
+
+    int score = 0;
+    int lives = 0;
+    int level = 0;
+
+    std::uint64_t inputTime = 0;          // Newest input change this frame was simulated with (latency log)
+
+    /**
+     * @brief Empty the snapshot but keep the allocated memory
+     */
+    /**
+     * @brief World rectangle of a chunk
+     */
+    sf::FloatRect chunkRect(std::uint32_t chunk) const {
+        return sf::FloatRect(worldOrigin.x + (chunk % chunkColumns) * chunkPixels,
+                             worldOrigin.y + (chunk / chunkColumns) * chunkPixels,
+                             chunkPixels, chunkPixels);
+    }
+
+    void clear() {
+        sprites.clear();
+        particles.clear();
+        mushroomChanges.clear();
+    }
+};
+
+#endif // FRAME_SNAPSHOT_H
@@ -11,7 +11,7 @@
 #define GAME_OVER_SCREEN_H
 
 #include "Screen.h"
-#include "button.h"
+#include "ButtonGroup.h"
 #include "ScreenManager.h"
 #include <string>
 
@@ -26,6 +26,7 @@ public:
 
     void initialize() override;
     GameState update(sf::Event &event) override;
+    void flushInput() override;
     void render() override;
     void cleanup() override;
 
@@ -40,6 +41,7 @@ private:
     Button *playAgainButton;
     Button *mainMenuButton;
     Button *submitButton;
+    ButtonGroup buttons;
 
     sf::RectangleShape background;
     sf::RectangleShape nameInputBox;
@@ -0,0 +1,51 @@
+/**
+ * @file InputSnapshot.h
+ * @author Ian Codding II
+ * @brief Gameplay buttons as seen by one simulation tick
+ * @version 1.0
+ * @date 2025-12-13
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The InputSystem builds one of these at the start of every tick and the
+ * tick only ever reads it, so every system in the tick agrees on what
+ * was pressed.
+ */
+
+#ifndef INPUT_SNAPSHOT_H
+#define INPUT_SNAPSHOT_H
+
+#include <cstdint>
+
+/**
+ * @brief Gameplay buttons, one bit each
+ */
+enum InputButton : std::uint16_t {
+    INPUT_LEFT  = 1u << 0,   // A or Left arrow
+    INPUT_RIGHT = 1u << 1,   // D or Right arrow
+    INPUT_UP    = 1u << 2,   // W or Up arrow
+    INPUT_DOWN  = 1u << 3,   // S or Down arrow
+    INPUT_FIRE  = 1u << 4    // Space
+};
+
+/**
+ * @struct InputSnapshot
+ * @brief Button state for one tick
+ */
+struct InputSnapshot {
+    std::uint16_t held = 0;      // Down at the newest sample
+    std::uint16_t pressed = 0;   // Went down since the last tick (even if already released again)
+    std::uint64_t tick = 0;      // Ticks since the InputSystem was created
+    std::uint64_t newestChange = 0;  // Steady-clock µs the newest consumed change was sampled (0 = none yet)
+
+    bool isDown(InputButton button) const { return (held & button) != 0; }
+    bool wasPressed(InputButton button) const { return (pressed & button) != 0; }
+
+    /**
+     * @brief Down now, or tapped and released since the last tick
+     *          A tap shorter than a frame still counts
+     */
+    bool isActive(InputButton button) const { return ((held | pressed) & button) != 0; }
+};
+
+#endif // INPUT_SNAPSHOT_H
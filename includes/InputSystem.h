@@ -0,0 +1,94 @@
+/**
+ * @file InputSystem.h
+ * @author Ian Codding II
+ * @brief Samples the keyboard on its own thread, one InputSnapshot per tick
+ * @version 1.0
+ * @date 2025-12-13
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * HOW IT WORKS:
+ * - The input thread reads the gameplay keys SAMPLE_HZ times a second
+ * - Whenever the set of held buttons changes it pushes the new set,
+ *   stamped with the time it was read, into a lock-free SPSC ring
+ * - beginTick() (simulation thread) drains the ring and folds every
+ *   change into one InputSnapshot, so a press and release between two
+ *   frames is still seen as a press
+ *
+ * LATENCY METRICS (Profiler):
+ * - input.latency_us: time from a change being read on the input thread
+ *   to the tick that consumed it
+ * - input.short_taps: presses released again before the tick consumed
+ *   them (frame-rate polling with sf::Keyboard would have missed these)
+ *
+ * If the thread is not running, beginTick() reads the keys directly, like
+ * the old per-frame polling (SFML only allows keyboard reads on the main
+ * thread on macOS).
+ */
+
+#ifndef INPUT_SYSTEM_H
+#define INPUT_SYSTEM_H
+
+#include "InputSnapshot.h"
+#include "SpscRing.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+class InputSystem {
+public:
+    InputSystem();
+    ~InputSystem();
+
+    InputSystem(const InputSystem&) = delete;
+    InputSystem& operator=(const InputSystem&) = delete;
+
+    /**
+     * @brief Start sampling on the input thread
+     */
+    void start();
+
+    /**
+     * @brief Join the input thread
+     */
+    void stop();
+
+    bool isRunning() const { return running; }
+
+    /**
+     * @brief Consume every change since the last tick (simulation thread only)
+     */
+    InputSnapshot beginTick();
+
+    /**
+     * @brief Drop queued changes without reporting them (e.g. after a pause)
+     */
+    void discard();
+
+    /**
+     * @brief Read the gameplay keys right now (any thread SFML allows)
+     */
+    static std::uint16_t sampleDevices();
+
+    static constexpr int SAMPLE_HZ = 1000;
+
+private:
+    struct InputEvent {
+        std::uint64_t time = 0;      // Microseconds, steady clock
+        std::uint16_t buttons = 0;   // Held buttons after the change
+    };
+
+    void inputLoop();
+    static std::uint64_t nowMicros();
+
+    SpscRing<InputEvent, 256> ring;
+    std::thread thread;
+    std::atomic<bool> running;
+
+    // Simulation-thread state
+    std::uint16_t held;
+    std::uint64_t newestChange;
+    std::uint64_t tickCount;
+};
+
+#endif // INPUT_SYSTEM_H
@@ -0,0 +1,129 @@
+/**
+ * @file JobSystem.h
+ * @author Ian Codding II
+ * @brief Small work-stealing job system for simulation phases
+ * @version 1.0
+ * @date 2025-12-08
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * HOW IT WORKS:
+ * - A fixed pool of worker threads is created once (core count - 1,
+ *   the calling thread is the last "worker")
+ * - Every thread owns a deque: it pushes and pops its own work at the back,
+ *   idle threads steal from the front of someone else's deque
+ * - Jobs are created for one frame, wired together with addDependency(),
+ *   then run() executes the whole graph and returns when it is done
+ *
+ * Example (from Game::update):
+ * ```cpp
+ * JobSystem::Job* bulletsJob = jobs.parallelFor(bullets.size(), 64, ...);
+ * JobSystem::Job* chainJob = jobs.createJob([&]() { chain->move(dt, *grid); });
+ * jobs.addDependency(chainJob, bulletsJob);   // chain waits for bullets
+ * jobs.run();
+ * ```
+ */
+
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobSystem {
+public:
+    /**
+     * @struct Job
+     * @brief One unit of work and the jobs waiting on it
+     */
+    struct Job {
+        std::function<void()> task;      // Work to do
+        std::vector<Job*> continuations; // Jobs that depend on this one
+        std::atomic<int> pendingDeps;    // Prerequisites not finished yet
+
+        Job() : pendingDeps(0) {}
+    };
+
+    /**
+     * @brief Start the worker pool
+     * @param workerCount Threads to create, 0 = one per core minus the caller
+     */
+    explicit JobSystem(unsigned workerCount = 0);
+
+    /**
+     * @brief Stop and join all workers
+     */
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Create a job for the current graph (not started until run())
+     * @param task Work to do
+     * @return Handle used for dependencies
+     */
+    Job* createJob(std::function<void()> task);
+
+    /**
+     * @brief Make job wait until prerequisite has finished
+     */
+    void addDependency(Job* job, Job* prerequisite);
+
+    /**
+     * @brief Split [0, count) into jobs of at most grain items
+     *
+     * @param count Number of items
+     * @param grain Items per job
+     * @param body Called with [begin, end) for each chunk
+     * @return A job that finishes after every chunk, for use in dependencies
+     */
+    Job* parallelFor(std::size_t count, std::size_t grain,
+                     std::function<void(std::size_t, std::size_t)> body);
+
+    /**
+     * @brief Execute every created job, respecting dependencies
+     *
+     * The calling thread works too, so run() returns as soon as the graph
+     * is finished. Jobs are freed afterwards.
+     */
+    void run();
+
+    /**
+     * @brief Threads taking part in run(), including the caller
+     */
+    unsigned getThreadCount() const { return static_cast<unsigned>(queues.size()); }
+
+private:
+    /**
+     * @struct WorkQueue
+     * @brief Per-thread deque - owner uses the back, thieves use the front
+     */
+    struct WorkQueue {
+        std::mutex lock;
+        std::deque<Job*> jobs;
+    };
+
+    std::vector<std::thread> workers;
+    std::deque<WorkQueue> queues;    // Index 0 belongs to the thread calling run()
+    std::deque<Job> graph;           // Jobs of the current frame (stable addresses)
+
+    std::atomic<int> remainingJobs;  // Jobs of the graph not finished yet
+    std::atomic<int> queuedJobs;     // Jobs sitting in some deque
+    std::atomic<bool> stopping;
+    std::mutex sleepLock;
+    std::condition_variable wake;
+
+    void workerLoop(unsigned index);
+    void push(unsigned index, Job* job);
+    Job* findJob(unsigned index);
+    void execute(unsigned index, Job* job);
+};
+
+#endif // JOB_SYSTEM_H
@@ -12,7 +12,7 @@
 #define LEADERBOARD_SCREEN_H
 
 #include "Screen.h"
-#include "button.h"
+#include "ButtonGroup.h"
 #include <vector>
 #include <string>
 
@@ -28,22 +28,41 @@ struct LeaderboardEntry {
     LeaderboardEntry(const std::string& n, int s) : name(n), score(s) {}
 };
 
+/**
+ * @struct CachedGlyph
+ * @brief Metrics of one glyph in the font's texture page
+ *
+ * Looked up once per character when the screen is created so that
+ * building row geometry never has to ask the font again.
+ */
+struct CachedGlyph {
+    float advance;          // Horizontal offset to the next character
+    sf::FloatRect bounds;   // Quad bounds relative to the baseline
+    sf::IntRect textureRect; // Location in the font's texture page
+};
+
 /**
  * @class LeaderboardScreen
- * @brief Handles the leaderboard display showing top 10 scores
+ * @brief Handles the leaderboard display showing high scores
  * 
- * This screen displays the top 10 highest scores achieved by players.
+ * This screen displays the highest scores achieved by players.
  * It:
  * - Loads scores from a leaderboard file (leaderboard.txt)
- * - Displays them in a ranked list
+ * - Displays them in a ranked, scrollable list
  * - Allows navigation (Back button)
  * - Can save/load leaderboard data
  * 
  * Layout:
  * - "LEADERBOARD" title (large, green)
- * - Ranked list of top 10 scores (1-10)
+ * - Ranked list of scores, VISIBLE_ROWS at a time
  * - Each entry shows: Rank. PlayerName .... Score
  * - Back button to return to menu
+ *
+ * Rendering:
+ * - Every row is drawn from ONE vertex array textured with the font's glyph page
+ * - Only the rows currently scrolled into view generate geometry
+ * - Geometry is rebuilt only when the entries or the scroll position change
+ * - Mouse wheel, Up/Down, PageUp/PageDown, Home/End scroll the list
  * 
  * File format (leaderboard.txt):
  * ```
@@ -64,14 +83,23 @@ class LeaderboardScreen : public Screen {
 private:
     // Navigation button
     Button* backButton;             // "Back" - return to main menu
+    ButtonGroup buttons;            // Hit-testing for backButton
     
     // Leaderboard data
-    std::vector<LeaderboardEntry> entries;  // List of top scores
+    std::vector<LeaderboardEntry> entries;  // All stored scores, highest first
     
     // UI text elements
     sf::Text titleText;             // "LEADERBOARD" title
     sf::Text headerText;            // "RANK  PLAYER  SCORE" header
-    std::vector<sf::Text> rankTexts; // One text object per leaderboard entry
+    
+    // Row rendering
+    CachedGlyph glyphCache[95];     // Printable ASCII (32-126)
+    sf::VertexArray rowVertices;    // Triangles for every visible row
+    float rankColumnX;              // Left edge of the RANK column
+    float nameColumnX;              // Left edge of the PLAYER NAME column
+    float scoreColumnX;             // Left edge of the SCORE column
+    std::size_t scrollOffset;       // Index of the first visible entry
+    bool rowsDirty;                 // Geometry needs rebuilding before next render
     
     // Background
     sf::RectangleShape background;  // Black background
@@ -79,6 +107,12 @@ private:
     // File path for leaderboard data
     const std::string LEADERBOARD_FILE = "data/leaderboard.txt";
     
+    // Table limits and layout
+    static constexpr std::size_t TOP_SCORE_COUNT = 10;   // Ranks that prompt for a name
+    static constexpr std::size_t MAX_ENTRIES = 10000;    // Entries kept on file
+    static constexpr std::size_t VISIBLE_ROWS = 12;      // Rows that fit above the Back button
+    static constexpr unsigned ROW_CHARACTER_SIZE = 25;
+    
 public:
     /**
      * @brief Constructor - sets up initial state
@@ -108,12 +142,18 @@ public:
      * @brief Update - process events and return next state
      * 
      * Updates the Back button and checks for clicks.
+     * Scrolls the list on mouse wheel and navigation keys.
      * Returns MENU if Back is clicked, otherwise LEADERBOARD.
      * 
      * @param event The SFML event to process
      * @return Next state to transition to
      */
     GameState update(sf::Event& event) override;
+
+    /**
+     * @brief Hit-test the mouse once for the whole frame
+     */
+    void flushInput() override;
     
     /**
      * @brief Render - draw the leaderboard screen
@@ -132,7 +172,7 @@ public:
     /**
      * @brief Add a new score to the leaderboard
      * 
-     * Adds an entry, sorts by score (highest first), keeps only top 10.
+     * Adds an entry, sorts by score (highest first), keeps MAX_ENTRIES.
      * Does NOT automatically save to file - call save() after.
      * 
      * @param name Player name
@@ -175,20 +215,45 @@ private:
     void sortByScore();
     
     /**
-     * @brief Keep only top 10 entries
+     * @brief Keep only the best MAX_ENTRIES entries
+     * 
+     * Called after adding a new score or loading from file.
+     * Removes any entries beyond MAX_ENTRIES.
+     */
+    void keepTopEntries();
+    
+    /**
+     * @brief Cache glyph metrics for printable ASCII
+     * 
+     * Asks the font for every glyph once so its texture page holds
+     * all characters rows can use. Called from the constructor.
+     */
+    void buildGlyphCache();
+    
+    /**
+     * @brief Move the first visible row by a number of rows
+     * 
+     * Clamps so the last page stays full and marks geometry dirty.
+     * 
+     * @param rows Rows to scroll (negative scrolls up)
+     */
+    void scrollBy(long rows);
+    
+    /**
+     * @brief Rebuild the vertex array for the visible rows
      * 
-     * Called after adding a new score.
-     * Removes any entries beyond the top 10.
+     * Only entries [scrollOffset, scrollOffset + VISIBLE_ROWS) generate quads.
      */
-    void keepTop10();
+    void buildRowGeometry();
     
     /**
-     * @brief Format the rank text for display
+     * @brief Append the quads for one string to rowVertices
      * 
-     * Creates text objects for all entries to be displayed.
-     * Called after loading leaderboard.
+     * @param str Text to lay out (characters outside ASCII draw as '?')
+     * @param x Left edge of the text
+     * @param baseline Baseline y position
      */
-    void formatRankText();
+    void appendString(const std::string& str, float x, float baseline);
 };
 
 #endif // LEADERBOARD_SCREEN_H
\ No newline at end of file
@@ -12,7 +12,7 @@
 #define MAIN_MENU_SCREEN_H
 
 #include "Screen.h"
-#include "button.h"
+#include "ButtonGroup.h"
 
 /**
  * @class MainMenuScreen
@@ -48,6 +48,9 @@ private:
     Button* confirmYesButton;    // "Yes" - confirm quit
     Button* confirmNoButton;     // "No" - cancel quit
     bool showQuitDialog;         // Whether dialog is currently showing
+
+    ButtonGroup menuButtons;     // Hit-testing for the 4 main buttons
+    ButtonGroup dialogButtons;   // Hit-testing for Yes/No
     
     // UI text elements
     sf::Text titleText;          // "CENTIPEDE" title
@@ -97,6 +100,11 @@ public:
      * @return Next state to transition to
      */
     GameState update(sf::Event& event) override;
+
+    /**
+     * @brief Hit-test the mouse once for the whole frame
+     */
+    void flushInput() override;
     
     /**
      * @brief Render - draw the main menu
@@ -0,0 +1,91 @@
+/**
+ * @file ParticleSystem.h
+ * @author Ian Codding II
+ * @brief Fixed-capacity structure-of-arrays particles for hit and explosion effects
+ * @version 1.0
+ * @date 2025-12-17
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * HOW IT WORKS:
+ * - Every particle field is its own float array (x, y, vx, vy, life...),
+ *   all allocated once at CAPACITY; emitting past it drops particles
+ * - update() integrates in fixed blocks of LANES particles with no
+ *   branches or calls inside, so the compiler vectorises it
+ * - A second pass removes dead particles by swap-and-pop, so the live
+ *   ones stay packed at the front
+ * - writeInstances() copies the visible ones into the FrameSnapshot;
+ *   the render thread turns them into one untextured vertex array
+ */
+
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+#include "FrameSnapshot.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Effect presets, see ParticleSystem::emit()
+ */
+enum class ParticleEffect : std::uint8_t {
+    MushroomChips,
+    SegmentExplosion,
+    EnemyExplosion,
+    MuzzleFlash,
+    Count
+};
+
+class ParticleSystem {
+public:
+    explicit ParticleSystem(std::size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Start one burst of an effect
+     * @return Particles actually added (fewer when the pool is full)
+     */
+    std::size_t emit(ParticleEffect effect, sf::Vector2f position);
+
+    /**
+     * @brief Move every particle, then remove the expired ones
+     */
+    void update(float dt);
+
+    /**
+     * @brief Append the particles inside a world rectangle to a snapshot list
+     */
+    void writeInstances(std::vector<ParticleInstance>& out, const sf::FloatRect& visible) const;
+
+    void clear() { count = 0; }
+
+    std::size_t size() const { return count; }
+    std::size_t capacity() const { return maxCount; }
+
+    static constexpr std::size_t DEFAULT_CAPACITY = 100000;
+    static constexpr float GRAVITY = 600.0f;   // Pixels per second squared, pulls chips down
+    static constexpr std::size_t LANES = 8;    // Particles integrated per block (one AVX register)
+
+private:
+    void integrate(float dt);
+    void removeExpired();
+    float random(float low, float high);
+    static std::size_t padded(std::size_t n) { return (n + LANES - 1) / LANES * LANES; }
+
+    std::size_t maxCount;
+    std::size_t count;
+
+    // One array per field, index i is particle i
+    std::vector<float> x, y;
+    std::vector<float> vx, vy;
+    std::vector<float> life;        // Seconds left
+    std::vector<float> invLife;     // 1 / starting life, for the fade
+    std::vector<float> edge;        // Side of the square, pixels
+    std::vector<float> gravity;     // 0 or 1, multiplies GRAVITY
+    std::vector<std::uint32_t> color;   // RGBA at full life
+
+    std::uint32_t seed;             // xorshift state
+};
+
+#endif // PARTICLE_SYSTEM_H
@@ -12,7 +12,7 @@
 #define PAUSE_SCREEN_H
 
 #include "Screen.h"
-#include "button.h"
+#include "ButtonGroup.h"
 
 /**
  * @class PauseScreen
@@ -51,6 +51,9 @@ private:
     Button* confirmYesButton;       // "Yes" - confirm quit
     Button* confirmNoButton;        // "No" - cancel quit
     bool showQuitDialog;            // Whether quit confirmation is showing
+
+    ButtonGroup menuButtons;        // Hit-testing for Resume/Main Menu/Quit
+    ButtonGroup dialogButtons;      // Hit-testing for Yes/No
     
     // UI text elements
     sf::Text pausedText;            // "PAUSED" title
@@ -99,6 +102,11 @@ public:
      * @return Next state to transition to
      */
     GameState update(sf::Event& event) override;
+
+    /**
+     * @brief Hit-test the mouse once for the whole frame
+     */
+    void flushInput() override;
     
     /**
      * @brief Render - draw the pause screen
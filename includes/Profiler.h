@@ -0,0 +1,51 @@
+/**
+ * @file Profiler.h
+ * @author Ian Codding II
+ * @brief Named per-frame counters, averaged and logged periodically
+ * @version 1.0
+ * @date 2025-12-12
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Systems record one sample per frame under a short name (e.g.
+ * "cull.drawn"). print() logs the average and maximum of every counter
+ * since the last print and starts a new window.
+ *
+ * Main thread only.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+class Profiler {
+public:
+    /**
+     * @brief Add one sample to a counter (created on first use)
+     */
+    void record(const std::string& name, double value);
+
+    /**
+     * @brief Log average / max of every counter, then reset them
+     */
+    void print();
+
+private:
+    struct Stat {
+        double total = 0.0;
+        double max = 0.0;
+        std::uint64_t samples = 0;
+    };
+
+    std::map<std::string, Stat> stats;   // Sorted, so the log order is stable
+};
+
+/**
+ * @brief Profiler shared by all game systems
+ */
+Profiler& profiler();
+
+#endif // PROFILER_H
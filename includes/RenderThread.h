@@ -0,0 +1,131 @@
+/**
+ * @file RenderThread.h
+ * @author Ian Codding II
+ * @brief Draws gameplay frames on their own thread from FrameSnapshots
+ * @version 1.0
+ * @date 2025-12-08
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * HOW IT WORKS (triple buffering):
+ * - Three FrameSnapshot slots: one being written by the simulation,
+ *   one being drawn by the render thread, one "latest" in between
+ * - publish() swaps the written slot with the latest slot (one atomic exchange)
+ * - The render thread swaps its slot with the latest one when a new frame is flagged
+ * - Neither side ever waits for the other, so vsync stalls in
+ *   window.display() only block the render thread
+ *
+ * MUSHROOM LAYERS:
+ * - Mushrooms are drawn once into one off-screen sf::RenderTexture per
+ *   world chunk, and each visible chunk is one textured quad per frame
+ * - Each snapshot carries the mushroom changes not yet acknowledged; only
+ *   the region of each change is cleared and redrawn in its chunk
+ * - Chunk textures are created when a chunk comes into view and released
+ *   once it is more than a chunk away, so memory follows the camera
+ * - If a texture cannot be created, mushrooms are batched with the other
+ *   sprites instead
+ *
+ * PACING:
+ * - A FramePacer (shared with the simulation) decides when each frame is
+ *   drawn (the window itself has no frame rate limit)
+ * - After display() the thread waits for the GPU (glFinish), so at most
+ *   one frame is ever in flight and none queue up in the driver
+ *
+ * The window's OpenGL context belongs to the render thread while it runs.
+ * Menus still draw on the main thread, so main.cpp starts the thread
+ * when gameplay starts and stops it before drawing any menu.
+ */
+
+#ifndef RENDER_THREAD_H
+#define RENDER_THREAD_H
+
+#include "FramePacer.h"
+#include "FrameSnapshot.h"
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+
+class RenderThread {
+public:
+    RenderThread(sf::RenderWindow& win, sf::Font& fnt, FramePacer& framePacer);
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    /**
+     * @brief Hand the window to a new render thread
+     */
+    void start();
+
+    /**
+     * @brief Join the render thread and give the window back to the caller
+     */
+    void stop();
+
+    bool isRunning() const { return running; }
+
+    /**
+     * @brief Slot the simulation may fill (cleared, memory kept)
+     */
+    FrameSnapshot& beginFrame();
+
+    /**
+     * @brief Make the slot from beginFrame() the latest frame
+     */
+    void publish();
+
+    /**
+     * @brief Last mushroom change drawn into the layer (any thread)
+     */
+    MushroomAck getMushroomAck() const;
+
+private:
+    sf::RenderWindow& window;
+    FramePacer& pacer;
+
+    FrameSnapshot slots[3];
+    unsigned writeIndex;              // Only touched by the simulation thread
+    unsigned readIndex;               // Only touched by the render thread
+    std::atomic<unsigned> latest;     // Slot index, plus FRESH_FRAME when unread
+    static const unsigned FRESH_FRAME = 4;
+
+    std::thread thread;
+    std::atomic<bool> running;
+
+    // Render-thread-only drawing state
+    sf::VertexArray batch;
+    sf::VertexArray particleBatch;                    // Untextured, drawn over batch
+    sf::Text scoreText;
+    sf::Text livesText;
+    sf::Text levelText;
+    int shownScore, shownLives, shownLevel;
+
+    // Mushroom layers (render thread only, except the ack)
+    struct ChunkLayer {
+        std::unique_ptr<sf::RenderTexture> texture;          // Null while off screen
+        std::map<std::uint32_t, SpriteInstance> mushrooms;   // By cell; map order = stacking order
+    };
+    std::map<std::uint32_t, ChunkLayer> chunkLayers;  // By chunk
+    bool layersSupported;                             // false after a failed create()
+    std::uint32_t layerSession;
+    std::uint64_t layerSequence;
+    sf::VertexArray layerBatch;
+    std::atomic<std::uint64_t> mushroomAck;           // Session << 48 | sequence
+
+    void renderLoop();
+    bool acquireLatest();
+    void drawSnapshot(const FrameSnapshot& snapshot);
+    void applyMushroomChanges(const FrameSnapshot& snapshot);
+    void streamChunkLayers(const FrameSnapshot& snapshot);
+    bool createChunkTexture(ChunkLayer& layer, float chunkPixels);
+    void redrawLayerRegion(ChunkLayer& layer, sf::FloatRect chunkRect, sf::FloatRect region, const sf::Texture* atlas);
+    static sf::FloatRect viewRect(const sf::View& view);
+    static void appendSprite(sf::VertexArray& vertices, const SpriteInstance& instance);
+    static void writeParticles(sf::VertexArray& vertices, const std::vector<ParticleInstance>& particles);
+};
+
+#endif // RENDER_THREAD_H
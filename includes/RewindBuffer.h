@@ -0,0 +1,105 @@
+/**
+ * @file RewindBuffer.h
+ * @author Ian Codding II
+ * @brief Bounded history of save states for rewinding live gameplay
+ * @version 1.0
+ * @date 2025-12-19
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * HOW IT WORKS:
+ * - Every captured tick is a Game::saveState() byte string
+ * - Every KEYFRAME_INTERVAL captures one is kept whole (a keyframe); the
+ *   ones in between are stored as a delta against the capture before:
+ *   the bytes XORed with the previous ones, runs of zeros (everything
+ *   that did not move) collapsed into one varint
+ * - Entries live in a ring; once they use more than the byte budget the
+ *   oldest keyframe and its deltas are dropped together
+ * - stepBack() drops the newest capture and rebuilds the one before from
+ *   its keyframe, which is at most KEYFRAME_INTERVAL - 1 deltas away
+ * - Buffers of dropped entries are reused, so capturing does not
+ *   allocate once the ring has filled
+ *
+ * CAPTURE BUDGET:
+ * Each capture (encode + delta) is timed. If one takes longer than
+ * CAPTURE_BUDGET_US, captures are spread out to every 2nd, 4th ... tick
+ * (up to MAX_STRIDE), and brought back to every tick once they are
+ * cheap again, so the average cost per tick stays under the budget.
+ */
+
+#ifndef REWIND_BUFFER_H
+#define REWIND_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+class RewindBuffer {
+public:
+    explicit RewindBuffer(std::size_t budgetBytes = DEFAULT_BUDGET);
+
+    /**
+     * @brief Count one tick; true if this tick should be captured
+     */
+    bool wantsCapture();
+
+    /**
+     * @brief Store a tick's save state
+     * @param encodeMicros Time the caller spent producing state (counted against the budget)
+     */
+    void capture(const std::vector<std::uint8_t>& state, std::uint64_t encodeMicros);
+
+    /**
+     * @brief Forget the newest capture and rebuild the one before it
+     * @return false (state untouched) when there is nothing older left
+     */
+    bool stepBack(std::vector<std::uint8_t>& state);
+
+    void clear();
+
+    std::size_t captures() const { return entries.size(); }
+    std::size_t bytes() const { return totalBytes; }
+    unsigned stride() const { return captureStride; }
+
+    /**
+     * @brief Log history length, memory per second and capture cost
+     * @param tickRate Simulation ticks per second
+     */
+    void report(double tickRate);
+
+    static constexpr std::size_t DEFAULT_BUDGET = 16 * 1024 * 1024;
+    static constexpr std::size_t KEYFRAME_INTERVAL = 30;     // Captures per keyframe
+    static constexpr std::uint64_t CAPTURE_BUDGET_US = 500;
+    static constexpr unsigned MAX_STRIDE = 8;
+
+private:
+    struct Entry {
+        bool keyframe = false;
+        unsigned stride = 1;               // Ticks since the capture before
+        std::vector<std::uint8_t> data;    // Whole state, or delta against the capture before
+    };
+
+    void evict();
+    std::vector<std::uint8_t> takeBuffer();
+    void recycle(Entry& entry);
+
+    static void encodeDelta(const std::vector<std::uint8_t>& base, const std::vector<std::uint8_t>& next,
+                            std::vector<std::uint8_t>& out);
+    static void applyDelta(const std::vector<std::uint8_t>& delta, std::vector<std::uint8_t>& state);
+
+    std::size_t budget;
+    std::size_t totalBytes;              // data.size() of every entry
+    std::deque<Entry> entries;           // Oldest first; entries.front() is always a keyframe
+    std::vector<std::uint8_t> latest;    // Whole state of entries.back()
+    std::vector<std::vector<std::uint8_t>> spare;
+    std::size_t sinceKeyframe;
+
+    unsigned captureStride;
+    unsigned tickCounter;
+
+    // For report()
+    std::uint64_t costTotal, costMax, costSamples;
+};
+
+#endif // REWIND_BUFFER_H
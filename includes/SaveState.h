@@ -0,0 +1,112 @@
+/**
+ * @file SaveState.h
+ * @author Ian Codding II
+ * @brief Compact binary encoding for save states
+ * @version 1.0
+ * @date 2025-12-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * FILE LAYOUT:
+ * - "CSAV", format version (varint), payload, FNV-1a hash of the payload
+ *   (4 bytes). Game::loadState() checks all of it before changing anything.
+ *
+ * ENCODINGS:
+ * - Integers are LEB128 varints; signed ones are zigzagged first, so
+ *   small negative numbers stay small
+ * - Positions and velocities are delta-encoded: each float is stored as
+ *   the difference of its IEEE bit pattern from the previous value in
+ *   the same list, as a signed varint. That is lossless, and nearby
+ *   values (a column of bullets, enemies of one kind) take 1-3 bytes
+ *   instead of 4
+ * - writeBits() packs small fields (mushroom tiles are 4 bits) into a
+ *   bit stream that is padded to a whole byte by flushBits()
+ *
+ * Readers never throw: reading past the end returns zeros and clears
+ * ok(), which callers check once per section.
+ */
+
+#ifndef SAVE_STATE_H
+#define SAVE_STATE_H
+
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class SaveWriter
+ * @brief Appends encoded values to a byte vector
+ */
+class SaveWriter {
+public:
+    explicit SaveWriter(std::vector<std::uint8_t>& out);
+
+    void writeByte(std::uint8_t value);
+    void writeU32(std::uint32_t value);
+    void writeVarint(std::uint64_t value);
+    void writeSigned(std::int64_t value);
+    void writeFloat(float value);
+
+    /**
+     * @brief Store value as a delta from previous, then make it the new previous
+     */
+    void writeDelta(sf::Vector2f value, sf::Vector2f& previous);
+
+    void writeBits(std::uint32_t value, unsigned count);
+    void flushBits();
+
+    std::size_t size() const { return out.size(); }
+
+private:
+    void writeFloatDelta(float value, float previous);
+
+    std::vector<std::uint8_t>& out;
+    std::uint32_t bitBuffer;
+    unsigned bitCount;
+};
+
+/**
+ * @class SaveReader
+ * @brief Reads values written by SaveWriter from a byte range
+ */
+class SaveReader {
+public:
+    SaveReader(const std::uint8_t* data, std::size_t size);
+
+    std::uint8_t readByte();
+    std::uint32_t readU32();
+    std::uint64_t readVarint();
+    std::int64_t readSigned();
+    float readFloat();
+    sf::Vector2f readDelta(sf::Vector2f& previous);
+
+    std::uint32_t readBits(unsigned count);
+    void alignBits();
+
+    /**
+     * @brief Read a count and check it against a limit (fails ok() if above)
+     */
+    std::size_t readCount(std::size_t limit);
+
+    bool ok() const { return !failed; }
+    void fail() { failed = true; }
+    std::size_t remaining() const { return size - position; }
+
+private:
+    float readFloatDelta(float previous);
+
+    const std::uint8_t* data;
+    std::size_t size;
+    std::size_t position;
+    std::uint32_t bitBuffer;
+    unsigned bitCount;
+    bool failed;
+};
+
+/**
+ * @brief FNV-1a hash of a byte range (save file integrity check)
+ */
+std::uint32_t saveHash(const std::uint8_t* data, std::size_t size);
+
+#endif // SAVE_STATE_H
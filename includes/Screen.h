@@ -29,6 +29,7 @@ protected:
     // Protected members can be accessed by derived classes
     sf::RenderWindow& window;  // Reference to the main window (shared by all screens)
     sf::Font& font;            // Reference to the shared font (loaded once in ScreenManager)
+    bool dirty;                // Something changed since the last render()
     
 public:
     /**
@@ -41,7 +42,7 @@ public:
      * @param fnt Reference to the loaded font
      */
     Screen(sf::RenderWindow& win, sf::Font& fnt) 
-        : window(win), font(fnt) {}
+        : window(win), font(fnt), dirty(true) {}
     
     /**
      * @brief Virtual destructor - ensures proper cleanup of derived classes
@@ -80,6 +81,15 @@ public:
      * @return The game state to transition to (or current state to stay)
      */
     virtual GameState update(sf::Event& event) = 0;
+
+    /**
+     * @brief Finish the input of one frame
+     * 
+     * Called once per frame after every event went through update().
+     * Screens with buttons hit-test the newest mouse position here, so a
+     * burst of MouseMoved events costs one hit-test instead of one each.
+     */
+    virtual void flushInput() {}
     
     /**
      * @brief Render the screen
@@ -101,6 +111,28 @@ public:
      * we forget to call it manually.
      */
     virtual void cleanup() = 0;
+
+    /**
+     * @brief Redraw tracking
+     * 
+     * Menus only change when they get input, so the main loop redraws a
+     * screen only while it is dirty and otherwise sleeps in waitEvent().
+     * A screen marks itself dirty when an event changes what it shows
+     * (flushInput() does it for button states); ScreenManager marks it
+     * dirty when it is entered or the window is resized or refocused,
+     * and clean after render().
+     */
+    void markDirty() { dirty = true; }
+    void markClean() { dirty = false; }
+    bool isDirty() const { return dirty || isAnimating(); }
+
+    /**
+     * @brief Whether the screen changes on its own (no input needed)
+     * 
+     * An animating screen is redrawn every frame at the frame rate limit.
+     * No screen animates yet; override this when one does.
+     */
+    virtual bool isAnimating() const { return false; }
 };
 
 #endif
\ No newline at end of file
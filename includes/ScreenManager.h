@@ -216,6 +216,13 @@ public:
      * @param event The SFML event to process (mouse click, key press, etc.)
      */
     void update(sf::Event& event);
+
+    /**
+     * @brief Let the current screen process the input of the whole frame
+     * 
+     * Called once per frame, after the event loop (see Screen::flushInput()).
+     */
+    void flushInput();
     
     /**
      * @brief Render - forward to current screen
@@ -225,6 +232,14 @@ public:
      * Each screen knows how to draw itself.
      */
     void render();
+
+    /**
+     * @brief Whether the current screen needs to be drawn again
+     * 
+     * False while a menu is idle, so main.cpp can block in waitEvent()
+     * instead of redrawing the same frame 60 times a second.
+     */
+    bool needsRedraw() const;
     
     /**
      * @brief Get current state
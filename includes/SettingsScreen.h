@@ -9,7 +9,7 @@
 #define SETTINGS_SCREEN_H
 
 #include "Screen.h"
-#include "button.h"
+#include "ButtonGroup.h"
 
 /**
  * @class SettingsScreen
@@ -35,6 +35,8 @@ private:
     // Spawn level adjustment buttons
     Button* levelUpButton;        // "+" - increase spawn level
     Button* levelDownButton;      // "-" - decrease spawn level
+
+    ButtonGroup buttons;          // Hit-testing for all of the above
     
     // Settings values
     int lives;                    // Number of lives
@@ -67,6 +69,11 @@ public:
      * @brief Update logic (button clicks, etc.)
      */
     GameState update(sf::Event& event) override;
+
+    /**
+     * @brief Hit-test the mouse once for the whole frame
+     */
+    void flushInput() override;
     
     /**
      * @brief Render all UI elements
@@ -0,0 +1,66 @@
+/**
+ * @file SpscRing.h
+ * @author Ian Codding II
+ * @brief Lock-free single-producer / single-consumer ring buffer
+ * @version 1.0
+ * @date 2025-12-13
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * One thread pushes, one other thread pops, neither ever blocks.
+ * head is only written by the consumer and tail only by the producer,
+ * so each side needs one acquire load of the other's index and one
+ * release store of its own. The indices run freely and are masked on
+ * use, so a full ring still tells "full" apart from "empty".
+ */
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+
+template <typename T, std::size_t Capacity>
+class SpscRing {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SpscRing() : head(0), tail(0) {}
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /**
+     * @brief Producer side - false (and nothing stored) when the ring is full
+     */
+    bool push(const T& value) {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        items[t & (Capacity - 1)] = value;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Consumer side - false when the ring is empty
+     */
+    bool pop(T& out) {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        out = items[h & (Capacity - 1)];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    // Own cache lines, so the two threads do not fight over one line
+    alignas(64) std::atomic<std::size_t> head;   // Next slot to read (consumer)
+    alignas(64) std::atomic<std::size_t> tail;   // Next slot to write (producer)
+    alignas(64) T items[Capacity];
+};
+
+#endif // SPSC_RING_H
@@ -0,0 +1,94 @@
+/**
+ * @file StateChecksum.h
+ * @author Ian Codding II
+ * @brief Per-tick hash of all gameplay state, for catching determinism breaks
+ * @version 1.0
+ * @date 2025-12-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * HOW IT WORKS:
+ * - Each system feeds its state into the checksum at the end of a tick:
+ *   beginEntity() starts a new entity (player, bullet 3, segment 1.7,
+ *   chunk 12 ...), and add*() mixes values into that entity's hash.
+ *   Floats are hashed by bit pattern, so any drift at all shows up.
+ * - Every entity hash is folded into the tick hash in the order the
+ *   entities were fed, so an iteration-order change shows up too
+ * - Nothing is allocated once the entity list has grown to its largest
+ *
+ * LOG (--checksum FILE):
+ *   tick <n> dt <seconds> input <held>/<pressed> hash <16 hex digits>
+ *     <kind> <index>[.<part>] <16 hex digits>
+ *     ...
+ * Two logs are compared with tools/checksum_diff (make checksum-diff),
+ * which reports the first tick whose hash differs and the entities that
+ * differ in it.
+ */
+
+#ifndef STATE_CHECKSUM_H
+#define STATE_CHECKSUM_H
+
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class StateChecksum {
+public:
+    StateChecksum();
+
+    /**
+     * @brief Log every tick to path (replaced if it exists)
+     * @return false if the file cannot be written
+     */
+    bool openLog(const std::string& path);
+
+    void beginTick(std::uint64_t tick, float dt, std::uint16_t held, std::uint16_t pressed);
+
+    /**
+     * @brief Start hashing a new entity
+     * @param kind Static string naming the entity type
+     * @param index Entity number within its kind
+     * @param part Sub-entity (segment of a chain), -1 for none
+     */
+    void beginEntity(const char* kind, int index, int part = -1);
+
+    void add(std::uint64_t value);
+    void addSigned(std::int64_t value) { add(static_cast<std::uint64_t>(value)); }
+    void addFloat(float value);
+    void addVector(sf::Vector2f value);
+    void addBytes(const std::uint8_t* data, std::size_t size);
+
+    /**
+     * @brief Fold the last entity in, log the tick if logging
+     * @return Hash of the whole tick
+     */
+    std::uint64_t endTick();
+
+    std::uint64_t value() const { return tickHash; }
+
+private:
+    struct EntityHash {
+        const char* kind;
+        int index, part;
+        std::uint64_t hash;
+    };
+
+    void finishEntity();
+    void writeLog();
+
+    std::uint64_t tick;
+    float dt;
+    std::uint16_t held, pressed;
+
+    std::uint64_t tickHash;
+    std::uint64_t entityHash;
+    bool inEntity;
+    std::vector<EntityHash> entities;   // Only kept while logging
+
+    std::ofstream log;
+};
+
+#endif // STATE_CHECKSUM_H
@@ -0,0 +1,118 @@
+/**
+ * @file    World.h
+ * @author  Balin Becker
+ * @brief   Chunked playfield with mushroom tiles and per-chunk entity lists
+ * @date    2025-12-11
+ *
+ * The playfield is split into square chunks of CHUNK_CELLS x CHUNK_CELLS
+ * grid cells. Chunks near the camera are active: their tiles live in a
+ * MushroomField and the simulation runs there. Distant chunks are packed
+ * (run-length encoded) and unpacked again when the camera comes near or
+ * something needs to change them.
+ *
+ * Cells are addressed with one world-wide index (row * columns + column),
+ * so callers never deal with chunks directly.
+ *
+ * The world also keeps the centipede FlowField in step with its tiles.
+ */
+
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "FlowField.h"
+#include "SaveState.h"
+#include "StateChecksum.h"
+#include "entity_registry.h"
+#include "grid.h"
+#include "mushroom.h"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+class World {
+public:
+    static constexpr int CHUNK_CELLS = 32;    // Chunk edge, in grid cells
+    static constexpr int ACTIVE_MARGIN = 1;   // Chunks kept active around the view
+
+    World(const Grid& grid);
+
+    // ===== CELLS (world-wide index) =====
+    int getColumns() const {return mColumns;};
+    int getRows() const {return mRows;};
+    int cellIndex(int column, int row) const {return row * mColumns + column;};
+
+    bool isEmpty(int cell) const;
+    std::size_t count() const;
+    bool place(int cell, int hp = MAXHEALTH, bool isSuper = false);
+    bool hit(int cell, int dmg);
+    bool poison(int cell);
+    bool isPoisoned(int cell) const;
+    int cellAt(sf::Vector2f position) const;
+    int firstHit(const sf::FloatRect& bounds) const;
+    bool anyInRect(const sf::FloatRect& bounds) const;
+    SpriteInstance spriteAt(int cell) const;
+    int alignedCell(const sf::FloatRect& bounds) const;
+    const FlowField& getFlow() const {return mFlow;};
+
+    // ===== CHUNKS =====
+    int getChunkColumns() const {return mChunkColumns;};
+    int getChunkCount() const {return mChunkColumns * mChunkRows;};
+    float getChunkPixels() const {return CHUNK_CELLS * mCellSize;};
+    sf::Vector2f getOrigin() const {return mOrigin;};
+    int chunkOfCell(int cell) const;
+    int chunkAt(sf::Vector2f position) const;
+    sf::FloatRect getChunkRect(int chunk) const;
+    bool isActive(int chunk) const {return mChunks[chunk].tiles != nullptr;};
+    bool isActiveAt(sf::Vector2f position) const;
+
+    void stream(const sf::FloatRect& view);
+    std::size_t packedBytes() const;
+
+    // ===== SAVE STATES =====
+    struct SavedMushrooms {
+        std::vector<int> cells;             // Ascending world cells
+        std::vector<std::uint8_t> tiles;    // Tile byte of each cell
+    };
+
+    void saveState(SaveWriter& out) const;
+    bool parseState(SaveReader& in, SavedMushrooms& saved) const;
+    void applyState(const SavedMushrooms& saved, std::vector<int>& placedCells);
+    void restoreState(const SavedMushrooms& saved, std::vector<int>& changedCells);
+    bool loadState(SaveReader& in, std::vector<int>& placedCells);
+    void hashState(StateChecksum& sum) const;
+
+    // ===== ENTITY LISTS =====
+    void indexEntities(const ecs::Registry& reg);
+    const std::vector<ecs::Entity>& getEntities(int chunk) const {return mChunks[chunk].entities;};
+    void collectEntities(const sf::FloatRect& region, std::vector<ecs::Entity>& out) const;
+
+private:
+    struct Chunk {
+        std::unique_ptr<MushroomField> tiles;    // Null while packed
+        std::vector<std::uint8_t> packed;        // RLE tiles while inactive
+        std::size_t packedCount = 0;             // Mushrooms in the packed tiles
+        std::vector<ecs::Entity> entities;       // Colliders whose position is in this chunk
+    };
+
+    void fieldShape(int chunk, sf::Vector2f& origin, int& columns, int& rows) const;
+    std::unique_ptr<MushroomField> makeField(int chunk) const;
+    std::uint8_t tileAt(int chunk, int local) const;
+    void collectMushrooms(std::vector<std::pair<int, std::uint8_t>>& mushrooms) const;
+    int packedHit(int chunk, const sf::FloatRect& bounds, bool lowest) const;
+    MushroomField& activate(int chunk);
+    void deactivate(int chunk);
+    int localCell(int cell, int chunk) const;
+    int globalCell(int chunk, int local) const;
+    bool chunkRange(const sf::FloatRect& bounds, int& cx1, int& cy1, int& cx2, int& cy2) const;
+
+    sf::Vector2f mOrigin;
+    float mCellSize;
+    int mColumns, mRows;
+    int mChunkColumns, mChunkRows;
+    std::vector<Chunk> mChunks;
+    FlowField mFlow;
+};
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ * @file aabb_kernel.h
+ * @author Roman Salazar
+ * @brief Batch AABB overlap test against packed min/max arrays
+ * @version 1.0
+ * @date 2025-12-10
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Tests one box against many boxes stored as four float arrays
+ * (minX, minY, maxX, maxY) and writes one hit bit per box, 8 boxes
+ * per output byte: bit j of masks[i / 8] is box i = 8 * (i / 8) + j.
+ *
+ * The implementation is picked once at runtime: AVX2 (8 boxes per
+ * step), SSE2 (4 per step) or plain scalar code. Overlap follows
+ * sf::FloatRect::intersects - boxes that only touch do not hit.
+ */
+
+#ifndef AABB_KERNEL_H
+#define AABB_KERNEL_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace aabb {
+
+/**
+ * @brief Bytes needed in the mask buffer for count boxes
+ */
+inline std::size_t maskBytes(std::size_t count) {
+    return (count + 7) / 8;
+}
+
+/**
+ * @brief Hit mask of box (left, top, right, bottom) against count packed boxes
+ * @param masks Output, at least maskBytes(count) bytes
+ */
+void overlapMasks(float left, float top, float right, float bottom,
+                  const float* minX, const float* minY, const float* maxX, const float* maxY,
+                  std::size_t count, std::uint8_t* masks);
+
+/**
+ * @brief Scalar version, always available (used for the tail and for benchmarks)
+ */
+void overlapMasksScalar(float left, float top, float right, float bottom,
+                        const float* minX, const float* minY, const float* maxX, const float* maxY,
+                        std::size_t count, std::uint8_t* masks);
+
+#if defined(__x86_64__) || defined(__i386__)
+/**
+ * @brief The SIMD versions overlapMasks() picks from, for benchmarks
+ *          overlapMasksAvx2() needs hasAvx2()
+ */
+void overlapMasksSse2(float left, float top, float right, float bottom,
+                      const float* minX, const float* minY, const float* maxX, const float* maxY,
+                      std::size_t count, std::uint8_t* masks);
+void overlapMasksAvx2(float left, float top, float right, float bottom,
+                      const float* minX, const float* minY, const float* maxX, const float* maxY,
+                      std::size_t count, std::uint8_t* masks);
+bool hasAvx2();
+#endif
+
+/**
+ * @brief Name of the implementation overlapMasks() dispatches to
+ */
+const char* implementationName();
+
+} // namespace aabb
+
+#endif // AABB_KERNEL_H
@@ -3,6 +3,8 @@
  * @author  Balin Becker
  * @brief   Collision Object but with animated sprites
  * @date    2025-11-24
+ *
+ * Frames are advanced by Registry::updateAnimations(), not per object.
  */
 
 #ifndef ANIMATED_OBJECT_H
@@ -12,15 +14,7 @@
 
 class anim_obj : public c_obj {
 public:
-    anim_obj(sf::Texture& texture, sf::IntRect StartFrame, int frames, std::string name);
-    void update(float deltaTime);
-private:
-    sf::Vector2f mPos;
-    sf::Vector2f mSize;
-    int mFrames, frameCount = 0;
-
-    const float fps = 0.15;
-    float totalElapsed = 0.0;
+    anim_obj(sf::Texture& texture, const atlas::Clip& clip, ecs::EntityType type);
 };
 
-#endif
\ No newline at end of file
+#endif
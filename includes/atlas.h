@@ -0,0 +1,84 @@
+/**
+ * @file    atlas.h
+ * @author  Balin Becker
+ * @brief   Frame rectangles of assets/sprites/atlas.png
+ * @date    2025-12-10
+ *
+ * The atlas is a grid of 8x8 cells. Every animation and every mushroom
+ * state is a compile-time table of cells, so nothing at runtime has to
+ * work out where a frame lives - it just indexes a table.
+ */
+
+#ifndef ATLAS_H
+#define ATLAS_H
+
+#include <SFML/Graphics.hpp>
+
+namespace atlas {
+
+constexpr int CELL = 8;
+
+/**
+ * @brief One atlas rectangle (sf::IntRect has no constexpr constructor)
+ */
+struct Frame {
+    int left, top, width, height;
+
+    sf::IntRect rect() const { return sf::IntRect(left, top, width, height); }
+};
+
+/**
+ * @brief 8x8 cell at column, row
+ */
+constexpr Frame cell(int column, int row) {
+    return Frame{column * CELL, row * CELL, CELL, CELL};
+}
+
+/**
+ * @brief A run of frames played in order
+ */
+struct Clip {
+    const Frame* frames;
+    int count;
+    float frameTime;   // Seconds per frame
+};
+
+// ===== CENTIPEDE =====
+
+inline constexpr Frame CENTIPEDE_SEGMENT_FRAMES[] = {cell(0, 0), cell(1, 0), cell(2, 0), cell(3, 0)};
+inline constexpr Frame CENTIPEDE_HEAD_FRAMES[]    = {cell(0, 1), cell(1, 1), cell(2, 1), cell(3, 1)};
+
+inline constexpr Clip CENTIPEDE_SEGMENT = {CENTIPEDE_SEGMENT_FRAMES, 4, 0.15f};
+inline constexpr Clip CENTIPEDE_HEAD    = {CENTIPEDE_HEAD_FRAMES, 4, 0.15f};
+
+// ===== ENEMIES =====
+
+inline constexpr Frame FLEA_FRAMES[]     = {cell(0, 2), cell(1, 2), cell(2, 2), cell(3, 2)};
+inline constexpr Frame SPIDER_FRAMES[]   = {cell(8, 0), cell(9, 0), cell(10, 0), cell(11, 0)};
+inline constexpr Frame SCORPION_FRAMES[] = {cell(4, 3), cell(5, 3), cell(6, 3), cell(7, 3)};
+
+inline constexpr Clip FLEA     = {FLEA_FRAMES, 4, 0.1f};
+inline constexpr Clip SPIDER   = {SPIDER_FRAMES, 4, 0.1f};
+inline constexpr Clip SCORPION = {SCORPION_FRAMES, 4, 0.15f};
+
+// ===== MUSHROOMS =====
+
+constexpr int MUSHROOM_MAX_HEALTH = 4;
+
+/**
+ * @brief Mushroom frame by [super][health]
+ *          Row 2 is the normal mushroom, row 3 the super one; columns
+ *          8..11 go from full to broken. Health 0 keeps the broken frame.
+ */
+inline constexpr Frame MUSHROOM_FRAMES[2][MUSHROOM_MAX_HEALTH + 1] = {
+    {cell(11, 2), cell(11, 2), cell(10, 2), cell(9, 2), cell(8, 2)},
+    {cell(11, 3), cell(11, 3), cell(10, 3), cell(9, 3), cell(8, 3)}
+};
+
+// ===== BULLET =====
+
+inline constexpr Frame BULLET = {64, 32, 32, 32};
+
+} // namespace atlas
+
+#endif
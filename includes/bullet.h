@@ -11,6 +11,7 @@
 #define BULLET_H
 
 #include "collision_object.h"
+#include "InputSnapshot.h"
 #include <SFML/Graphics.hpp>
 
 class Bullet : public c_obj {
@@ -19,34 +20,30 @@ public:
     Bullet() : alive(false) {}
 
     // Main constructor - creates real bullets
+    // Movement is done by Registry::integrateVelocities()
     Bullet(sf::Texture &bulletTexture, sf::Vector2i startPos, float speed = 600.0f)
-        : c_obj(bulletTexture, sf::IntRect(64, 32, 32, 32), 
-                sf::Vector2f(startPos.x, startPos.y), "Bullet"),
+        : c_obj(bulletTexture, atlas::BULLET.rect(), 
+                sf::Vector2f(startPos.x, startPos.y), ecs::EntityType::Bullet),
           alive(true) {
-        velocity = sf::Vector2f(0.0f, -speed);
+        ecs::Velocity velocity;
+        velocity.value = sf::Vector2f(0.0f, -speed);
+        ecs::registry().velocities.add(mEntity, velocity);
     }
 
     void kill() { alive = false; }
-    
-    void update(float dt) {
-        if (!alive) return;
-        mSprite.move(velocity * dt);
-        if (mSprite.getPosition().y < -50.0f) {
-            alive = false;
-        }
-    }
 
-    bool isAlive() const { return alive; }
+    // Off the top of the screen counts as dead
+    bool isAlive() const { return alive && getPosition().y >= -50.0f; }
 
     // Shooting function
-    static void shoot(sf::Vector2f playerPos, float deltaTime, sf::Texture &bulletTex);
+    static bool shoot(sf::Vector2f playerPos, float deltaTime, sf::Texture &bulletTex, const InputSnapshot &input);
 
     static std::vector<Bullet*> bullets;
     static float timeSinceLastShot;
     static float shootCooldown;
+    static constexpr float SPEED = 1000.0f;   // Pixels per second, upwards
 
 private:
-    sf::Vector2f velocity;
     bool alive;
 };
 
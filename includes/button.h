@@ -37,11 +37,13 @@ class Button : public sf::Drawable {
     sf::Vector2f getPosition() { return mPosition; };
     sf::Vector2f getDimensions() { return sf::Vector2f(mButton.getGlobalBounds().width, mButton.getGlobalBounds().height); };
     sf::Uint32 getState() { return mBtnState; };
+    // screen-space rectangle of the button (rotation is only ever 0 or 180, so it never changes shape)
+    sf::FloatRect getBounds() const { return mButton.getGlobalBounds(); };
     const sf::Text &getSFMLText() const { return mText; }
     std::string getText() const; // NEW: Returns the label as std::string
 
-    // This function update the button buttonState and/or look
-    void update(sf::Event &e, sf::RenderWindow &window);
+    // change the button state and its look (hit-testing is done by ButtonGroup)
+    void setState(buttonState state);
     virtual void draw(sf::RenderTarget &target, sf::RenderStates states) const;
 
   private:
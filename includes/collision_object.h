@@ -3,11 +3,15 @@
  * @author  Balin Becker
  * @brief   Basic collision object class
  * @date    2025-11-24
+ *
+ * A c_obj no longer stores its own sprite - it owns one ecs::Entity and
+ * reads/writes that entity's components in the registry.
  */
 
 #ifndef COLLISION_OBJECT_H
 #define COLLISION_OBJECT_H
 
+#include "entity_registry.h"
 #include <SFML/Graphics.hpp>
 #include <iostream>
 #include <vector>
@@ -15,32 +19,35 @@
 class c_obj : public sf::Drawable {
     public:
         c_obj();
-        c_obj(sf::Texture& texture):c_obj(texture, sf::IntRect(0, 0, 0, 0), sf::Vector2f(0, 0), "Default") {}
-        c_obj(sf::Texture& texture, sf::IntRect spriteTexture, sf::Vector2f pos, std::string name);
+        c_obj(sf::Texture& texture):c_obj(texture, sf::IntRect(0, 0, 0, 0), sf::Vector2f(0, 0), ecs::EntityType::Default) {}
+        c_obj(sf::Texture& texture, sf::IntRect spriteTexture, sf::Vector2f pos, ecs::EntityType type);
 
         ~c_obj();
 
-        std::vector<c_obj*> getCollided();
-        std::vector<c_obj*> getCollided(sf::FloatRect region);
+        // Components hold a pointer back to this handle, so it must not be copied
+        c_obj(const c_obj&) = delete;
+        c_obj& operator=(const c_obj&) = delete;
+
+        std::vector<c_obj*> getCollided(std::uint32_t mask = ecs::LAYER_ALL);
+        std::vector<c_obj*> getCollided(sf::FloatRect region, std::uint32_t mask = ecs::LAYER_ALL);
 
         void setPosition(sf::Vector2f pos);
         void setSpriteRect(sf::IntRect spriteTexture);
         void setScale(sf::Vector2i factor);
         
-        std::string getName() const {return mName;};
-        sf::Sprite getSprite() const {return mSprite;};
-        sf::Vector2f getPosition() const {return mPosition;};
+        ecs::Entity getEntity() const {return mEntity;};
+        ecs::EntityType getType() const {return ecs::registry().colliders.get(mEntity).type;};
+        std::uint32_t getCategory() const {return ecs::registry().colliders.get(mEntity).category;};
+        const std::string& getName() const {return *mName;};
+        sf::Sprite getSprite() const;
+        sf::Vector2f getPosition() const {return ecs::registry().transforms.get(mEntity).position;};
+        sf::FloatRect getBounds() const {return ecs::registry().cachedBounds(mEntity);};
 
         virtual void draw(sf::RenderTarget& target,sf::RenderStates states) const;
 
     protected:
-        sf::Sprite mSprite;
-        sf::Texture* mTexture;
-        sf::Vector2f mPosition;
-        std::string mName;
-
-    private:
-        static std::vector<c_obj*> objects;
+        ecs::Entity mEntity;
+        const std::string* mName;   // Interned, for debug output only
 };
 
-#endif
\ No newline at end of file
+#endif
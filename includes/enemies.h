@@ -0,0 +1,114 @@
+/**
+ * @file    enemies.h
+ * @author  Balin Becker
+ * @brief   Flea, spider and scorpion on pooled registry entities
+ * @date    2025-12-12
+ *
+ * Every enemy is a plain registry entity (Transform, Sprite, Collider,
+ * Animation, Velocity, Health) with no c_obj handle. What differs per
+ * kind lives in the ENEMY_DEFS table; how a kind behaves is one update
+ * kernel that walks that kind's own array.
+ *
+ * - Flea:     falls straight down, sometimes dropping a mushroom
+ * - Spider:   zigzags through the player area, eating mushrooms
+ * - Scorpion: crosses the upper field, poisoning mushrooms
+ *
+ * Each kind's array is reserved to CAPACITY up front and removal is
+ * swap-and-pop, so spawning and killing never allocate once the
+ * registry's component arrays have grown to their peak.
+ */
+
+#ifndef ENEMIES_H
+#define ENEMIES_H
+
+#include "SaveState.h"
+#include "World.h"
+#include "atlas.h"
+#include "entity_registry.h"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+enum class EnemyKind : std::uint8_t {Flea, Spider, Scorpion, Count};
+
+/**
+ * @brief Data that differs between enemy kinds
+ */
+struct EnemyDef {
+    ecs::EntityType type;
+    const atlas::Clip* clip;
+    float speed;        // Pixels per second
+    int hp;
+    int score;          // Awarded when shot
+    float spawnEvery;   // Seconds between spawns in normal play
+};
+
+inline constexpr EnemyDef ENEMY_DEFS[] = {
+    {ecs::EntityType::Flea,     &atlas::FLEA,     300.0f, 2, 200, 7.0f},
+    {ecs::EntityType::Spider,   &atlas::SPIDER,   180.0f, 1, 600, 5.0f},
+    {ecs::EntityType::Scorpion, &atlas::SCORPION, 120.0f, 1, 1000, 11.0f}
+};
+
+class EnemySystem {
+public:
+    static constexpr std::size_t CAPACITY = 1024;   // Per kind
+
+    EnemySystem(sf::Texture& texture);
+    ~EnemySystem();
+
+    EnemySystem(const EnemySystem&) = delete;
+    EnemySystem& operator=(const EnemySystem&) = delete;
+
+    bool spawn(EnemyKind kind, const sf::FloatRect& region);
+    void spawnTimed(float dt, const sf::FloatRect& region);
+    void update(float dt, World& world, const sf::FloatRect& region, std::vector<int>& changedCells);
+
+    static bool isEnemy(ecs::EntityType type);
+    bool isAlive(ecs::Entity e) const;
+    int hit(ecs::Entity e);
+    void kill(ecs::Entity e);
+    void removeDead();
+    void clear();
+
+    std::size_t count() const;
+    std::size_t count(EnemyKind kind) const {return mEnemies[static_cast<int>(kind)].size();};
+
+    // ===== SAVE STATES =====
+    struct SavedEnemy {
+        sf::Vector2f position, velocity;
+        int hp, lastCell, frame;
+        float timer, elapsed;
+    };
+    struct SavedState {
+        std::uint32_t random = 0;
+        float spawnTimers[static_cast<int>(EnemyKind::Count)] = {};
+        std::vector<SavedEnemy> enemies[static_cast<int>(EnemyKind::Count)];
+    };
+
+    void saveState(SaveWriter& out) const;
+    static bool parseState(SaveReader& in, SavedState& saved);
+    void applyState(const SavedState& saved);
+    void hashState(StateChecksum& sum) const;
+
+private:
+    struct Enemy {
+        ecs::Entity entity;
+        int lastCell;     // Cell the enemy was in last tick (-1 = outside)
+        float timer;      // Kind-specific (spider: time to next turn)
+    };
+
+    Enemy& create(EnemyKind kind, sf::Vector2f position, sf::Vector2f velocity);
+    void updateFleas(World& world, const sf::FloatRect& region, std::vector<int>& changedCells);
+    void updateSpiders(float dt, World& world, const sf::FloatRect& region, std::vector<int>& changedCells);
+    void updateScorpions(World& world, const sf::FloatRect& region, std::vector<int>& changedCells);
+
+    std::uint32_t random();
+    float randomRange(float low, float high);
+
+    sf::Texture* mTexture;
+    std::vector<Enemy> mEnemies[static_cast<int>(EnemyKind::Count)];
+    float mSpawnTimers[static_cast<int>(EnemyKind::Count)];
+    std::uint32_t mRandom;   // xorshift32 state, separate from rand()
+};
+
+#endif
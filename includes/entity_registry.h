@@ -0,0 +1,230 @@
+/**
+ * @file    entity_registry.h
+ * @author  Balin Becker
+ * @brief   Entity-component storage with dense component arrays
+ * @date    2025-12-09
+ *
+ * Every game object is just an Entity id. Its data lives in one
+ * ComponentArray per component type, packed tightly so systems
+ * (movement, animation, collision queries, rendering) walk
+ * contiguous memory instead of chasing object pointers.
+ *
+ * c_obj is now a thin handle that owns one Entity.
+ */
+
+#ifndef ENTITY_REGISTRY_H
+#define ENTITY_REGISTRY_H
+
+#include "FrameSnapshot.h"
+#include "atlas.h"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class c_obj;
+
+namespace ecs {
+
+typedef std::uint32_t Entity;
+const Entity NO_ENTITY = 0xFFFFFFFF;
+
+/**
+ * @brief Integer type tag, replaces comparing object names
+ */
+enum class EntityType : std::uint8_t {
+    Default,
+    Bullet,
+    CentipedeHead,
+    CentipedeSegment,
+    Flea,
+    Spider,
+    Scorpion,
+    Count
+};
+
+const char* typeName(EntityType type);
+
+/**
+ * @brief Collision categories, one bit each
+ *          Queries pass a mask of the categories they care about
+ */
+enum CollisionLayer : std::uint32_t {
+    LAYER_NONE              = 0,
+    LAYER_DEFAULT           = 1u << 0,
+    LAYER_BULLET            = 1u << 1,
+    LAYER_CENTIPEDE_HEAD    = 1u << 2,
+    LAYER_CENTIPEDE_SEGMENT = 1u << 3,
+    LAYER_ENEMY             = 1u << 4,   // Flea, spider, scorpion
+    LAYER_CENTIPEDE         = LAYER_CENTIPEDE_HEAD | LAYER_CENTIPEDE_SEGMENT,
+    LAYER_ALL               = 0xFFFFFFFFu
+};
+
+std::uint32_t layerOf(EntityType type);
+
+/**
+ * @brief Shared copy of a name; equal names get the same pointer
+ *          Only call from the main thread (object construction)
+ */
+const std::string* internName(const std::string& name);
+
+// ===== COMPONENTS =====
+
+struct Transform {
+    sf::Vector2f position;
+    sf::Vector2f scale = sf::Vector2f(1, 1);
+    sf::Vector2f origin;
+};
+
+struct Sprite {
+    const sf::Texture* texture = nullptr;
+    sf::IntRect rect;
+};
+
+struct Collider {
+    EntityType type = EntityType::Default;
+    std::uint32_t category = LAYER_DEFAULT;
+    bool dynamic = false;      // Moves every tick: bounds never cached, always tested exactly
+    c_obj* object = nullptr;   // Handle returned by collision queries
+};
+
+struct Health {
+    int hp = 0;
+};
+
+struct Animation {
+    const atlas::Frame* table = nullptr;   // Frame rects, from atlas.h
+    int frames = 1;
+    int frame = 0;
+    float elapsed = 0.0f;
+    float frameTime = 0.15f;
+};
+
+struct Velocity {
+    sf::Vector2f value;
+};
+
+/**
+ * @brief Dense array of one component type
+ *
+ * data() holds the components back to back; entityAt(i) says who owns
+ * data()[i]. A sparse index maps an Entity to its slot. Removal moves
+ * the last component into the hole, so the array never has gaps.
+ */
+template <typename T>
+class ComponentArray {
+public:
+    void add(Entity e, const T& component) {
+        if (e >= sparse.size()) {
+            sparse.resize(e + 1, NO_SLOT);
+        }
+        sparse[e] = static_cast<std::uint32_t>(dense.size());
+        dense.push_back(component);
+        owners.push_back(e);
+    }
+
+    void remove(Entity e) {
+        if (!has(e)) {
+            return;
+        }
+        std::uint32_t slot = sparse[e];
+        Entity last = owners.back();
+
+        dense[slot] = dense.back();
+        owners[slot] = last;
+        sparse[last] = slot;
+
+        dense.pop_back();
+        owners.pop_back();
+        sparse[e] = NO_SLOT;
+    }
+
+    bool has(Entity e) const { return e < sparse.size() && sparse[e] != NO_SLOT; }
+
+    void clear() {
+        dense.clear();
+        owners.clear();
+        sparse.clear();
+    }
+
+    T& get(Entity e) { return dense[sparse[e]]; }
+    const T& get(Entity e) const { return dense[sparse[e]]; }
+
+    std::size_t size() const { return dense.size(); }
+    T* data() { return dense.data(); }
+    const T* data() const { return dense.data(); }
+    Entity entityAt(std::size_t i) const { return owners[i]; }
+    std::size_t slotOf(Entity e) const { return sparse[e]; }
+
+private:
+    static constexpr std::uint32_t NO_SLOT = 0xFFFFFFFF;
+
+    std::vector<T> dense;
+    std::vector<Entity> owners;
+    std::vector<std::uint32_t> sparse;
+};
+
+/**
+ * @brief World-space AABBs of every collider, one float array per edge
+ *
+ * Slot i belongs to the collider in colliders.data()[i]. A slot is only
+ * recomputed from Transform + Sprite when it is marked dirty, so objects
+ * that do not move cost four loads per query instead of a transform.
+ * Dirty slots hold an infinite box until refreshed, so batch tests always
+ * report them and the caller re-tests them exactly.
+ */
+struct AabbArrays {
+    std::vector<float> minX, minY, maxX, maxY;
+    std::vector<std::uint8_t> dirty;
+};
+
+/**
+ * @brief Owns all entities and their components
+ */
+class Registry {
+public:
+    Entity create();
+    void destroy(Entity e);
+
+    ComponentArray<Transform> transforms;
+    ComponentArray<Sprite> sprites;
+    ComponentArray<Collider> colliders;
+    ComponentArray<Health> healths;
+    ComponentArray<Animation> animations;
+    ComponentArray<Velocity> velocities;
+
+    AabbArrays aabbs;
+
+    void addCollider(Entity e, const Collider& collider);
+
+    // ===== CACHED BOUNDS =====
+
+    void markBoundsDirty(Entity e);
+    void refreshBounds();
+    sf::FloatRect cachedBounds(Entity e) const;
+    void query(const sf::FloatRect& region, std::uint32_t mask, std::vector<Entity>& out) const;
+
+    // ===== SYSTEMS =====
+
+    sf::FloatRect bounds(Entity e) const;
+    void integrateVelocities(float dt, std::size_t begin, std::size_t end);
+    void updateAnimations(float dt);
+    void collectSprites(EntityType type, std::vector<SpriteInstance>& out) const;
+    std::size_t collectVisibleSprites(EntityType type, const std::vector<Entity>& candidates,
+                                      const sf::FloatRect& view, std::vector<SpriteInstance>& out) const;
+
+private:
+    SpriteInstance spriteInstance(Entity e) const;
+
+    std::vector<Entity> freeIds;
+    Entity nextId = 0;
+};
+
+/**
+ * @brief The registry shared by all game objects
+ */
+Registry& registry();
+
+} // namespace ecs
+
+#endif
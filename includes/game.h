@@ -18,25 +18,37 @@
 #include "player.h"
 #include "bullet.h"
 #include "Centipede.h"
-#include "mushroom.h"
+#include "enemies.h"
+#include "World.h"
 #include "SettingsScreen.h"
 #include "GameOverScreen.h"
 #include "LeaderboardScreen.h"
+#include "JobSystem.h"
+#include "FrameSnapshot.h"
+#include "Profiler.h"
+#include "DebugOptions.h"
+#include "InputSystem.h"
+#include "AudioSystem.h"
+#include "ParticleSystem.h"
+#include "SaveState.h"
+#include "RewindBuffer.h"
+#include "StateChecksum.h"
 
 /**
  * @brief Main Game class
  * Orchestrates gameplay: updates player, bullets, mushrooms,
  * centipede. Handles all collision detection. Manages game state.
+ * Independent update phases run as jobs on the JobSystem.
  */
 class Game {
 public:
-    Game(sf::RenderWindow& win, ScreenManager& screenMngr);
+    Game(sf::RenderWindow& win, ScreenManager& screenMngr, const DebugOptions& debugOptions = DebugOptions());
     ~Game();
 
     void initialize();
     void handleInput(const sf::Event& event);
     void update(float dt);
-    void render();
+    void buildSnapshot(FrameSnapshot& snapshot, const MushroomAck& ack);
 
     GameState getState() const;
     void setState(GameState newState);
@@ -47,9 +59,23 @@ public:
     void savePlayerScore(const std::string& playerName);
     void debugPrint() const;
 
+    // Save states (between ticks, main thread only)
+    void saveState(std::vector<std::uint8_t>& out) const;
+    bool loadState(const std::vector<std::uint8_t>& data, bool keepMushroomLayer = false);
+    bool saveStateFile(const std::string& path) const;
+    bool loadStateFile(const std::string& path);
+
+    static constexpr std::size_t STRESS_ENEMIES = 600;  // Enemies kept alive in stress mode
+    static constexpr std::uint32_t SAVE_VERSION = 2;     // Bump whenever the save layout changes
+    static constexpr int CENTIPEDE_LENGTH = 12;          // Segments in a new chain
+    static constexpr float FIELD_WIDTH = 950.0f;         // One field of the playfield (--world WxH)
+    static constexpr float FIELD_HEIGHT = 720.0f;
+    static constexpr float RESPAWN_SECONDS = 2.0f;       // Untouchable time after losing a life
+
 private:
     sf::RenderWindow& window;
     ScreenManager& screenManager;
+    DebugOptions options;
 
     GameState currentState;
     bool isGameOver;
@@ -60,22 +86,46 @@ private:
     int level;
 
     sf::RectangleShape* player;
-    Centipede* centipede;
-    std::vector<Mushroom*> mushrooms;
+    float respawnTimer;                   // Seconds the player is still untouchable after a hit
+    std::vector<Centipede*> centipedes;   // One entry per centipede chain
+    EnemySystem* enemies;                 // Fleas, spiders, scorpions
+    World* world;                               // Chunked mushroom tiles, one byte per grid cell
+    std::vector<int> dirtyMushrooms;            // World cells damaged since the last update
+    sf::View camera;                            // Follows the player when the world is taller than the window
+
+    // Mushroom changes not yet acknowledged by the render thread's layer
+    std::vector<MushroomChange> mushroomLog;
+    std::uint64_t mushroomSequence;
+    std::uint32_t mushroomSession;
     Grid* grid;
 
-    sf::RectangleShape background;
-    sf::Text scoreText;
-    sf::Text livesText;
-    sf::Text levelText;
+    JobSystem jobs;
+    InputSystem input;                            // Keyboard sampled on its own thread
+    AudioSystem audio;                            // Sound effects and music on their own thread
+    ParticleSystem particles;                     // Hit and explosion effects
+    RewindBuffer rewind;                          // Recent ticks (--rewind)
+    std::vector<std::uint8_t> rewindState;        // Scratch save state for capture / step back
+    std::uint64_t lastInputTime;                  // Newest input change simulated so far (for the latency log)
+    bool rewinding;                               // Backspace held: step back instead of simulating
+    StateChecksum checksum;                       // Hash of the gameplay state after each tick
+    std::uint64_t tickCount;                      // Ticks simulated this session
+    std::vector<int> bulletMushroomHits;          // Broad-phase result: mushroom cell per bullet, -1 = none
+    std::vector<ecs::Entity> bulletTargetHits;    // Centipede part or enemy per bullet, NO_ENTITY = none
+    std::vector<ecs::Entity> visibleCandidates;   // Culling: entities in chunks near the camera
 
     sf::Texture texture;
 
     bool loadTextures();
     void generateMushrooms();
     void handleCollisions();
+    void processMushroomEvents();
+    void logMushroom(int cell);
+    void updateCamera();
+    sf::FloatRect getCameraRect() const;
     void checkGameOver();
-    void updateUI();
+    void hashState(float dt, const InputSnapshot& buttons);
+    void spawnCentipede();
+    void removeDeadChains();
 };
 
 #endif // GAME_H
\ No newline at end of file
@@ -17,10 +17,18 @@ public:
     Grid(sf::FloatRect Region, int cellSize);
 
     sf::Vector2f GetPosition(sf::Vector2f position);
-    sf::FloatRect GetRegion() {return mRegion;};
+    sf::FloatRect GetRegion() const {return mRegion;};
+
+    // ===== CELL HELPERS =====
+    int GetCellSize() const {return mCellSize;};
+    int GetColumns() const {return mColumns;};
+    int GetRows() const {return mRows;};
+    sf::Vector2i GetCell(sf::Vector2f position) const;
+    sf::FloatRect GetCellRect(int column, int row) const;
 private:
     sf::FloatRect mRegion;
     int mCellSize;
+    int mColumns, mRows;
 };
 
-#endif
\ No newline at end of file
+#endif
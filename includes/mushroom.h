@@ -1,55 +1,78 @@
 /**
  * @file    mushroom.h
  * @author  Ian Codding II, Balin Becker
- * @brief   Mushroom Class
+ * @brief   Mushroom field - one byte per grid cell
  * @date    2025-10-21
  */
 
-// - Store position
-// - Track health (0-4)
-// - Change sprite based on health
-// - Remove when health reaches 0
+// - Store position        -> the cell index
+// - Track health (0-4)    -> low bits of the cell byte
+// - Change sprite based on health -> atlas::MUSHROOM_FRAMES lookup
+// - Remove when health reaches 0  -> a zero byte is an empty cell
 
 #ifndef MUSHROOM_H
 #define MUSHROOM_H
 
-#include "collision_object.h"
+#include "atlas.h"
+#include "grid.h"
+#include "FrameSnapshot.h"
 #include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
 
-// int MaxX = 100, MaxY = 100, MinX = 100, MinY = 100;
 extern const int MAXHEALTH;
 
-enum state { normal,
-             super,
-             destroy };
-
-class Mushroom : public c_obj {
-    // Texture
-    // Sprite
-    // Position
-    // Health
-    // Draw
+/**
+ * @brief Dense tile map of mushrooms at Grid cell resolution
+ *
+ * Each cell is one byte: bits 0-2 hold the health (0 = no mushroom),
+ * bit 3 marks a super mushroom. Collision tests, rendering and
+ * generation all read this array, so a mushroom costs one byte instead
+ * of a heap object.
+ */
+class MushroomField {
   public:
-    Mushroom(sf::Texture &texture, sf::IntRect spriteTexture = sf::IntRect(0, 0, 8, 8), sf::Vector2f pos = sf::Vector2f(0, 0), int hp = MAXHEALTH, bool isSuper = false);
-
-    // Default destructor;
-    ~Mushroom() {};
-    sf::FloatRect getBounds() const {
-        return mSprite.getGlobalBounds();
-    }
-    void hit(float dmg);
-    void hit(int dmg);
-    bool isDestroyed() const;
-    void update();
-    bool isAlive() const { return alive; }
-    void kill() { alive = false; }
+    static const std::uint8_t HEALTH_MASK = 0x07;
+    static const std::uint8_t SUPER_FLAG = 0x08;
+
+    MushroomField(const Grid &grid);
+    MushroomField(sf::Vector2f origin, float cellSize, int columns, int rows);
+
+    int getColumns() const { return mColumns; }
+    int getRows() const { return mRows; }
+    int getCellCount() const { return mColumns * mRows; }
+    int cellIndex(int column, int row) const { return row * mColumns + column; }
+
+    std::uint8_t tile(int cell) const { return mTiles[cell]; }
+    int health(int cell) const { return mTiles[cell] & HEALTH_MASK; }
+    bool isSuper(int cell) const { return (mTiles[cell] & SUPER_FLAG) != 0; }
+    bool isEmpty(int cell) const { return health(cell) == 0; }
+    std::size_t count() const { return mCount; }
+
+    bool place(int cell, int hp = MAXHEALTH, bool isSuper = false);
+    bool hit(int cell, int dmg);
+    bool poison(int cell);
+    void clear();
+
+    int firstHit(const sf::FloatRect &bounds) const;
+    bool anyInRect(const sf::FloatRect &bounds) const;
+
+    SpriteInstance spriteAt(int cell) const;
+    static SpriteInstance tileSprite(std::uint8_t tile, sf::Vector2f position, float cellSize);
+
+    // ===== SERIALISATION =====
+    void pack(std::vector<std::uint8_t> &out) const;
+    void unpack(const std::vector<std::uint8_t> &in);
+    static std::uint8_t packedTile(const std::vector<std::uint8_t> &in, int cell);
+
   private:
-    void updateTexture();
-    // void updateLvl();
-    bool alive;
+    bool cellRange(const sf::FloatRect &bounds, int &col1, int &row1, int &col2, int &row2) const;
 
-    sf::Uint32 mShroomState;
-    int mHealth; // When hp == 0, destroy
+    sf::Vector2f mOrigin;    // Top-left of the grid region
+    float mCellSize;
+    int mColumns, mRows;
+    std::size_t mCount;      // Cells with a mushroom
+    std::vector<std::uint8_t> mTiles;
 };
 
 #endif
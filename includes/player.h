@@ -16,6 +16,7 @@
 #define PLAYER_H
 
 #include "bullet.h"
+#include "InputSnapshot.h"
 #include <iostream>
 #include <SFML/Graphics.hpp>
 
@@ -26,7 +27,9 @@
 class Player {
   public:
     static void startPlayer(sf::RectangleShape &rectangle, sf::Texture &playerTexture);
-    static void movePlayer(sf::RectangleShape &playerRectangle, float deltaTime, const sf::FloatRect &gridBounds);
+    static void resetPlayer(sf::RectangleShape &rectangle);
+    static void movePlayer(sf::RectangleShape &playerRectangle, float deltaTime, const sf::FloatRect &gridBounds,
+                           const InputSnapshot &input);
     bool playerShoot(sf::RectangleShape &playerRect, sf::RectangleShape &bulletShape, sf::Texture &bulletTexture, Bullet &projectile);
 
   private:
@@ -0,0 +1,264 @@
+/**
+ * @file AudioSystem.cpp
+ * @author Ian Codding II
+ * @brief Audio thread, voice stealing and sound buffer loading
+ * @version 1.0
+ * @date 2025-12-16
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include "../includes/AudioSystem.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Per-sound settings; higher priority steals voices from lower
+ */
+struct SoundInfo {
+    const char* name;      // assets/audio/<name>.wav
+    int priority;
+    float volume;          // 0 - 100
+    float seconds;         // Length of the synthesized fallback
+    float startHz;         // Fallback pitch sweep (0 = noise)
+    float endHz;
+};
+
+const SoundInfo SOUNDS[] = {
+    { "shoot",         1,  40.0f, 0.08f, 1400.0f, 600.0f },
+    { "mushroom_hit",  0,  30.0f, 0.05f,  300.0f, 200.0f },
+    { "enemy_hit",     2,  70.0f, 0.25f,    0.0f,   0.0f },
+    { "centipede_hit", 2,  60.0f, 0.12f,  900.0f, 150.0f },
+    { "player_hit",    3, 100.0f, 0.60f,    0.0f,   0.0f },
+};
+
+static_assert(sizeof(SOUNDS) / sizeof(SOUNDS[0]) == static_cast<std::size_t>(SoundId::Count),
+              "One SoundInfo per SoundId");
+
+const char* MUSIC_FILE = "assets/audio/music.ogg";
+
+const SoundInfo& info(SoundId sound) {
+    return SOUNDS[static_cast<std::size_t>(sound)];
+}
+
+} // namespace
+
+/**
+ * @brief Construct a stopped, silent audio system
+ */
+AudioSystem::AudioSystem()
+    : running(false),
+      musicPaused(false),
+      haveMusic(false),
+      playCount(0),
+      stolenCount(0),
+      droppedCount(0) {
+    pending.fill(false);
+}
+
+/**
+ * @brief Stop the thread if it is still running
+ */
+AudioSystem::~AudioSystem() {
+    stop();
+}
+
+/**
+ * @brief Decode every effect once, before any voice plays
+ */
+void AudioSystem::load() {
+    for (std::size_t i = 0; i < SOUND_COUNT; i++) {
+        SoundId sound = static_cast<SoundId>(i);
+        std::string path = std::string("assets/audio/") + info(sound).name + ".wav";
+
+        if (!buffers[i].loadFromFile(path)) {
+            synthesize(sound);
+        }
+    }
+
+    std::cout << "[AudioSystem] " << SOUND_COUNT << " sounds loaded, "
+              << VOICE_COUNT << " voices" << std::endl;
+}
+
+/**
+ * @brief Start the audio thread (it opens the music)
+ */
+void AudioSystem::start() {
+    if (running) {
+        return;
+    }
+
+    musicPaused = false;
+    running = true;
+    thread = std::thread(&AudioSystem::audioLoop, this);
+
+    std::cout << "[AudioSystem] Started" << std::endl;
+}
+
+/**
+ * @brief Join the audio thread; it silences every voice on the way out
+ */
+void AudioSystem::stop() {
+    if (!running) {
+        return;
+    }
+
+    running = false;
+    thread.join();
+
+    std::cout << "[AudioSystem] Stopped (played " << playCount << ", stolen "
+              << stolenCount << ", dropped " << droppedCount << ")" << std::endl;
+}
+
+/**
+ * @brief Remember the sound for endTick()
+ */
+void AudioSystem::trigger(SoundId sound) {
+    pending[static_cast<std::size_t>(sound)] = true;
+}
+
+/**
+ * @brief Push each sound triggered this tick once
+ *          A sound that does not fit in a full ring is tried again next tick
+ */
+void AudioSystem::endTick() {
+    if (!running) {
+        pending.fill(false);
+        return;
+    }
+
+    for (std::size_t i = 0; i < SOUND_COUNT; i++) {
+        if (pending[i] && ring.push(static_cast<SoundId>(i))) {
+            pending[i] = false;
+        }
+    }
+}
+
+/**
+ * @brief Pause or resume the music on the audio thread's next pass
+ */
+void AudioSystem::setMusicPaused(bool paused) {
+    musicPaused = paused;
+}
+
+/**
+ * @brief Audio thread - open the music, then start queued sounds until stopped
+ */
+void AudioSystem::audioLoop() {
+    haveMusic = music.openFromFile(MUSIC_FILE);
+    if (haveMusic) {
+        music.setLoop(true);
+        music.setVolume(50.0f);
+        music.play();
+    } else {
+        std::cout << "[AudioSystem] No music (" << MUSIC_FILE << ")" << std::endl;
+    }
+
+    while (running) {
+        SoundId sound;
+        while (ring.pop(sound)) {
+            play(sound);
+        }
+
+        if (haveMusic) {
+            bool playing = music.getStatus() == sf::SoundSource::Playing;
+            if (musicPaused && playing) {
+                music.pause();
+            } else if (!musicPaused && !playing) {
+                music.play();
+            }
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(MIX_INTERVAL_MS));
+    }
+
+    for (Voice& voice : voices) {
+        voice.sound.stop();
+    }
+    if (haveMusic) {
+        music.stop();
+    }
+}
+
+/**
+ * @brief Start a sound on a free or stolen voice, or drop it
+ */
+void AudioSystem::play(SoundId sound) {
+    const SoundInfo& settings = info(sound);
+
+    Voice* voice = pickVoice(settings.priority);
+    if (voice == nullptr) {
+        droppedCount++;
+        return;
+    }
+
+    if (voice->sound.getStatus() != sf::SoundSource::Stopped) {
+        voice->sound.stop();
+        stolenCount++;
+    }
+
+    voice->sound.setBuffer(buffers[static_cast<std::size_t>(sound)]);
+    voice->sound.setVolume(settings.volume);
+    voice->priority = settings.priority;
+    voice->started = ++playCount;
+    voice->sound.play();
+}
+
+/**
+ * @brief A stopped voice, else the oldest of the lowest priority <= priority
+ * @return nullptr when every voice plays something more important
+ */
+AudioSystem::Voice* AudioSystem::pickVoice(int priority) {
+    Voice* victim = nullptr;
+
+    for (Voice& voice : voices) {
+        if (voice.sound.getStatus() == sf::SoundSource::Stopped) {
+            return &voice;
+        }
+        if (voice.priority > priority) {
+            continue;
+        }
+        if (victim == nullptr || voice.priority < victim->priority ||
+            (voice.priority == victim->priority && voice.started < victim->started)) {
+            victim = &voice;
+        }
+    }
+    return victim;
+}
+
+/**
+ * @brief Fallback when a sound file is missing: a decaying square sweep or noise burst
+ */
+void AudioSystem::synthesize(SoundId sound) {
+    const SoundInfo& settings = info(sound);
+    const float pi = 3.14159265f;
+
+    std::size_t count = static_cast<std::size_t>(settings.seconds * SAMPLE_RATE);
+    std::vector<sf::Int16> samples(count);
+
+    std::uint32_t noise = 0x1234567u;
+    float phase = 0.0f;
+    for (std::size_t i = 0; i < count; i++) {
+        float t = static_cast<float>(i) / count;
+        float envelope = (1.0f - t) * (1.0f - t);
+
+        float value;
+        if (settings.startHz > 0.0f) {
+            float hz = settings.startHz + (settings.endHz - settings.startHz) * t;
+            phase += 2.0f * pi * hz / SAMPLE_RATE;
+            value = std::sin(phase) >= 0.0f ? 1.0f : -1.0f;
+        } else {
+            noise = noise * 1664525u + 1013904223u;
+            value = static_cast<float>(noise >> 16) / 32768.0f - 1.0f;
+        }
+
+        samples[i] = static_cast<sf::Int16>(value * envelope * 12000.0f);
+    }
+
+    buffers[static_cast<std::size_t>(sound)].loadFromSamples(samples.data(), count, 1, SAMPLE_RATE);
+}
@@ -0,0 +1,184 @@
+/**
+ * @file ButtonGroup.cpp
+ * @author Ian Codding II
+ * @brief Implements per-frame mouse hit-testing for a set of buttons
+ * @version 1.0
+ * @date 2025-12-10
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include "../includes/ButtonGroup.h"
+
+/**
+ * @brief Construct an empty group
+ */
+ButtonGroup::ButtonGroup()
+    : hoveredIndex(-1),
+      pressedIndex(-1),
+      cursorMoved(false),
+      needsSample(true),
+      changed(false) {
+}
+
+/**
+ * @brief Add a button and cache its rectangle
+ *
+ * @param button Button owned by the screen (must outlive the group, or clear() first)
+ */
+void ButtonGroup::add(Button* button) {
+    if (button == nullptr) {
+        return;
+    }
+    buttons.push_back(button);
+    rects.push_back(button->getBounds());
+    needsSample = true;
+}
+
+/**
+ * @brief Forget every button
+ */
+void ButtonGroup::clear() {
+    buttons.clear();
+    rects.clear();
+    hoveredIndex = -1;
+    pressedIndex = -1;
+    cursorMoved = false;
+    needsSample = true;
+}
+
+/**
+ * @brief Recompute every cached rectangle
+ */
+void ButtonGroup::refreshRects() {
+    for (std::size_t i = 0; i < buttons.size(); i++) {
+        rects[i] = buttons[i]->getBounds();
+    }
+    cursorMoved = true;
+}
+
+/**
+ * @brief Feed one event to the group
+ *
+ * MouseMoved only stores the position. Left presses and releases hit-test
+ * their own position right away (it is newer than any pending move).
+ *
+ * @param event
+ * @param window Used to map pixels to default-view coordinates
+ * @return The button a left click landed on, or nullptr
+ */
+Button* ButtonGroup::handleEvent(const sf::Event& event, const sf::RenderWindow& window) {
+    switch (event.type) {
+    case sf::Event::MouseMoved: {
+        cursor = sf::Vector2i(event.mouseMove.x, event.mouseMove.y);
+        cursorMoved = true;
+        needsSample = false;
+        return nullptr;
+    }
+    case sf::Event::MouseLeft: {
+        cursorMoved = false;
+        setHovered(-1);
+        return nullptr;
+    }
+    case sf::Event::MouseButtonPressed: {
+        if (event.mouseButton.button != sf::Mouse::Left) {
+            return nullptr;
+        }
+        cursor = sf::Vector2i(event.mouseButton.x, event.mouseButton.y);
+        cursorMoved = false;
+        needsSample = false;
+
+        int index = hitTest(cursor, window);
+        pressedIndex = index;
+        setHovered(index);
+        if (index < 0) {
+            return nullptr;
+        }
+        buttons[index]->setState(clicked);
+        changed = true;
+        return buttons[index];
+    }
+    case sf::Event::MouseButtonReleased: {
+        if (event.mouseButton.button != sf::Mouse::Left) {
+            return nullptr;
+        }
+        cursor = sf::Vector2i(event.mouseButton.x, event.mouseButton.y);
+        cursorMoved = false;
+        needsSample = false;
+
+        int released = pressedIndex;
+        pressedIndex = -1;
+        setHovered(hitTest(cursor, window));
+        if (released >= 0) {
+            buttons[released]->setState(released == hoveredIndex ? hovered : normalButton);
+            changed = true;
+        }
+        return nullptr;
+    }
+    default:
+        return nullptr;
+    }
+}
+
+/**
+ * @brief Hit-test the newest cursor position (at most once per call)
+ *
+ * @param window
+ * @return true if a button changed state
+ */
+bool ButtonGroup::flush(const sf::RenderWindow& window) {
+    if (needsSample) {
+        // One OS query for a group that has not seen the mouse yet
+        cursor = sf::Mouse::getPosition(window);
+        cursorMoved = true;
+        needsSample = false;
+    }
+    if (cursorMoved) {
+        cursorMoved = false;
+        setHovered(hitTest(cursor, window));
+    }
+
+    bool result = changed;
+    changed = false;
+    return result;
+}
+
+/**
+ * @brief Drop the hover state and sample the cursor on the next flush()
+ */
+void ButtonGroup::resync() {
+    pressedIndex = -1;
+    setHovered(-1);
+    needsSample = true;
+}
+
+/**
+ * @brief Index of the button under a window pixel, -1 for none
+ */
+int ButtonGroup::hitTest(sf::Vector2i pixel, const sf::RenderWindow& window) const {
+    sf::Vector2f point = window.mapPixelToCoords(pixel, window.getDefaultView());
+    for (std::size_t i = 0; i < rects.size(); i++) {
+        if (rects[i].contains(point)) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Move the hover to another button
+ *          Only the button left and the button entered change state
+ */
+void ButtonGroup::setHovered(int index) {
+    if (index == hoveredIndex) {
+        return;
+    }
+    if (hoveredIndex >= 0) {
+        buttons[hoveredIndex]->setState(normalButton);
+    }
+    hoveredIndex = index;
+    changed = true;
+    if (hoveredIndex >= 0) {
+        buttons[hoveredIndex]->setState(hoveredIndex == pressedIndex ? clicked : hovered);
+    }
+}
@@ -7,26 +7,24 @@
 
 #include "../includes/Centipede.h"
 
-VertDirection vertState = VertDirection::down;
-HoriDirection horiState = HoriDirection::right;
-
 Centipede::Centipede(sf::Texture& Texture, int length, sf::Vector2f position, sf::Vector2i factor) {
     mLength = length;
     mSpacing = 15;
     mPosition = position;
     mTexture = &Texture;
+    mFactor = factor;
     
     for (int i = 0; i < length; i++) {
         if (i == 0) {
             // Create a head
-            anim_obj* headSeg = new anim_obj(Texture, sf::IntRect(0, 8*1, 8, 8), 4, "CentipedeHead");
+            anim_obj* headSeg = new anim_obj(Texture, atlas::CENTIPEDE_HEAD, ecs::EntityType::CentipedeHead);
             segment* head = new segment(headSeg, "Head");
             head->mSprite->setScale(factor);
             head->mSprite->setPosition(mPosition);
             mCentipedeVect.push_back(head);
         } else {
             // Create a segment
-            anim_obj* sSegment = new anim_obj(Texture, sf::IntRect(0, 8*0, 8, 8), 4, "CentipedeSegment");
+            anim_obj* sSegment = new anim_obj(Texture, atlas::CENTIPEDE_SEGMENT, ecs::EntityType::CentipedeSegment);
             segment* seg = new segment(sSegment, "Segment");
             seg->mSprite->setScale(factor);
             seg->mSprite->setPosition(sf::Vector2f(mPosition.x - i * mSpacing, mPosition.y));
@@ -43,45 +41,75 @@ Centipede::Centipede(sf::Texture& Texture, int length, sf::Vector2f position, sf
  * 
  */
 Centipede::~Centipede() {
-    for (int i = 0; i < mLength; i++) {
-        delete mCentipedeVect[i]->mSprite;
-        delete mCentipedeVect[i];
+    for (segment* seg : mCentipedeVect) {
+        delete seg->mSprite;
+        delete seg;
     }
 }
 
 /**
-<<<<<<< HEAD
  * @brief Hits the centipede at the located part
-=======
- * @brief Hits the Centipede at the located part
->>>>>>> 3df56bc79f854491f76b2bf4c343b94d0134d8bd
+ *        The part is removed; a hit in the middle splits the chain and
+ *        the segments behind the part carry on as a new chain. The
+ *        segments keep their entities, so only the shot one goes away.
  * 
- * @param part 
+ * @param part Segment that was hit
+ * @return The new rear chain (owned by the caller), or nullptr
  */
-void Centipede::hit(const c_obj* part) {
-    int targetIndex = 0;
-    for (int i = 0; i < mLength; i++) {
+Centipede* Centipede::hit(const c_obj* part) {
+    int targetIndex = -1;
+    for (int i = 0; i < static_cast<int>(mCentipedeVect.size()); i++) {
         if (mCentipedeVect[i]->mSprite == part) {
             targetIndex = i;
         }
     }
-    if (targetIndex == 0) { // Head
-        mCentipedeVect.erase(mCentipedeVect.begin());
-        mCentipedeVect.shrink_to_fit();
-    } else if (targetIndex == mLength - 1) { // End / Tail
-        mCentipedeVect.pop_back();
-    } else {
-        Centipede* leftCenti = new Centipede(*mTexture, targetIndex, mCentipedeVect[0]->mSprite->getPosition(), sf::Vector2i(2, 2));
-        Centipede* rightCenti = new Centipede(*mTexture, mLength - (targetIndex + 1), mCentipedeVect[mLength - (targetIndex + 1)]->mSprite->getPosition(), sf::Vector2i(2, 2));
-        this->~Centipede();
+    if (targetIndex < 0) {
+        return nullptr;
     }
+
+    Centipede* rear = nullptr;
+    if (targetIndex > 0 && targetIndex + 1 < static_cast<int>(mCentipedeVect.size())) {
+        rear = new Centipede(*mTexture, 0, mCentipedeVect[targetIndex + 1]->mSprite->getPosition(), mFactor);
+        rear->mCentipedeVect.assign(mCentipedeVect.begin() + targetIndex + 1, mCentipedeVect.end());
+        rear->mLength = static_cast<int>(rear->mCentipedeVect.size());
+        rear->vertState = vertState;
+        rear->horiState = horiState;
+        rear->diving = diving;
+        rear->elapsedTime = elapsedTime;
+        rear->promoteHead();
+    }
+
+    delete mCentipedeVect[targetIndex]->mSprite;
+    delete mCentipedeVect[targetIndex];
+    mCentipedeVect.erase(mCentipedeVect.begin() + targetIndex, rear ? mCentipedeVect.end() : mCentipedeVect.begin() + targetIndex + 1);
+    mLength = static_cast<int>(mCentipedeVect.size());
+    promoteHead();
+    return rear;
 }
 
+/**
+ * @brief Turns the front segment into a head if it is not one
+ *        (after the head was shot, or in a chain split off the back)
+ */
+void Centipede::promoteHead() {
+    if (mCentipedeVect.empty() || mCentipedeVect[0]->mName == "Head") {
+        return;
+    }
+
+    // Freed first, so the head usually reuses the segment's entity id and
+    // a bullet already aimed at that id still finds something there
+    sf::Vector2f position = mCentipedeVect[0]->mSprite->getPosition();
+    delete mCentipedeVect[0]->mSprite;
+    delete mCentipedeVect[0];
+
+    anim_obj* headSeg = new anim_obj(*mTexture, atlas::CENTIPEDE_HEAD, ecs::EntityType::CentipedeHead);
+    headSeg->setScale(mFactor);
+    headSeg->setPosition(position);
+    mCentipedeVect[0] = new segment(headSeg, "Head");
+}
 
 /**
  * @brief Places all centipede segments at position
-=======
- 
  * 
  * @param position Position to place at
  */
@@ -102,53 +130,49 @@ void Centipede::setScale(sf::Vector2i factor) {
     }
 }
 
-void Centipede::hit() {
-    if (!mCentipedeVect.empty()) {
-        segment* tail = mCentipedeVect.back();
-        delete tail->mSprite;
-        delete tail;
-        mCentipedeVect.pop_back();
-        mLength = static_cast<int>(mCentipedeVect.size()); // update length!
+/**
+ * @brief Checks whether a segment belongs to this centipede
+ * 
+ * @param part Entity of the segment
+ */
+bool Centipede::contains(ecs::Entity part) const {
+    for (const segment* seg : mCentipedeVect) {
+        if (seg->mSprite->getEntity() == part) {
+            return true;
+        }
     }
+    return false;
 }
 
-
-
 /**
- * @brief Moves the Centipede to the position
+ * @brief Moves the Centipede one cell every `speed` seconds
  * 
- * @param position Position to move to
+ * Bumping into a mushroom or the grid edge drops (or raises) the head a
+ * row and turns it; bumping into a poisoned mushroom makes it dive
+ * straight to the bottom row first.
  */
-void Centipede::move(float dt, Grid grid) {
+void Centipede::move(float dt, Grid grid, const World& world) {
+    if (mCentipedeVect.empty()) {
+        return;   // Shot to pieces; Game drops the chain after collisions
+    }
     elapsedTime += dt;
 
     if (elapsedTime >= speed) {
         elapsedTime -= speed;
 
         bool bumped = false;
-        sf::FloatRect bounds = mCentipedeVect[0]->mSprite->getSprite().getGlobalBounds();
+        bool poisoned = false;
+        sf::FloatRect bounds = mCentipedeVect[0]->mSprite->getBounds();
         sf::Vector2f hPos(bounds.left, bounds.top);
         sf::Vector2f hSize(bounds.width, bounds.height);
 
-        int lookDir = 0;
-        if (horiState == HoriDirection::left) {
-            lookDir = -16;
-        } else if (horiState == HoriDirection::right) {
-            lookDir = 16;
-        }
-
-        // Checks collisions and grid bounds
-        sf::FloatRect frontHitbox = sf::FloatRect(hPos.x + lookDir, hPos.y, hSize.x / 4, hSize.y);
-        std::vector<c_obj*> collisions = mCentipedeVect[0]->mSprite->getCollided(frontHitbox);
-        if (collisions.size() > 0) {
-            for (long unsigned int i = 0; i < collisions.size(); i++) {
-                if (collisions[i]->getName() == "Mushroom") {
-                    bumped = true;
-                    break;
-                }
+        // Diving: straight down until the bottom row
+        if (diving) {
+            if (hPos.y + hSize.y + 16 <= grid.GetRegion().top + grid.GetRegion().height) {
+                step(sf::Vector2f(0, 16));
+                return;
             }
-        } else if (!frontHitbox.intersects(grid.GetRegion())) {
-            bumped = true;
+            diving = false;
         }
 
         // Checks vertical limits
@@ -158,28 +182,41 @@ void Centipede::move(float dt, Grid grid) {
             vertState = VertDirection::up;
         }
 
+        int cell = world.alignedCell(bounds);
+        if (cell >= 0) {
+            // Head sits on one grid cell: the move is one table lookup
+            FlowField::Move next = world.getFlow().next(cell, horiState == HoriDirection::right, vertState == VertDirection::down);
+            bumped = (next == FlowField::Move::Down || next == FlowField::Move::Up || next == FlowField::Move::Dive);
+            poisoned = (next == FlowField::Move::Dive);
+        } else {
+            int lookDir = 0;
+            if (horiState == HoriDirection::left) {
+                lookDir = -16;
+            } else if (horiState == HoriDirection::right) {
+                lookDir = 16;
+            }
+
+            // Off-grid head: probe the space ahead for mushrooms and grid bounds
+            sf::FloatRect frontHitbox = sf::FloatRect(hPos.x + lookDir, hPos.y, hSize.x / 4, hSize.y);
+            int ahead = world.firstHit(frontHitbox);
+            if (ahead >= 0) {
+                bumped = true;
+                poisoned = world.isPoisoned(ahead);
+            } else if (!frontHitbox.intersects(grid.GetRegion())) {
+                bumped = true;
+            }
+        }
+
+        if (poisoned) {
+            diving = true;
+            vertState = VertDirection::down;
+        }
+
         if (bumped) {
-            
             if (vertState == VertDirection::down) {
-                sf::Vector2f prevPos = sf::Vector2f(mCentipedeVect[0]->mSprite->getPosition().x, mCentipedeVect[0]->mSprite->getPosition().y);
-                mCentipedeVect[0]->mSprite->setPosition(sf::Vector2f(mCentipedeVect[0]->mSprite->getPosition().x, mCentipedeVect[0]->mSprite->getPosition().y + 16));
-
-                for (int i = 1; i < mLength; i++) {
-                    sf::Vector2f currentPos = sf::Vector2f(mCentipedeVect[i]->mSprite->getPosition().x, mCentipedeVect[i]->mSprite->getPosition().y);
-                    mCentipedeVect[i]->mSprite->setPosition(prevPos);
-                    prevPos = currentPos;
-                }
-            
+                step(sf::Vector2f(0, 16));
             } else if (vertState == VertDirection::up) {
-                sf::Vector2f prevPos = sf::Vector2f(mCentipedeVect[0]->mSprite->getPosition().x, mCentipedeVect[0]->mSprite->getPosition().y);
-                mCentipedeVect[0]->mSprite->setPosition(sf::Vector2f(mCentipedeVect[0]->mSprite->getPosition().x, mCentipedeVect[0]->mSprite->getPosition().y - 16));
-
-                for (int i = 1; i < mLength; i++) {
-                    sf::Vector2f currentPos = sf::Vector2f(mCentipedeVect[i]->mSprite->getPosition().x, mCentipedeVect[i]->mSprite->getPosition().y);
-                    mCentipedeVect[i]->mSprite->setPosition(prevPos);
-                    prevPos = currentPos;
-                }
-
+                step(sf::Vector2f(0, -16));
             }
 
             if (horiState == HoriDirection::left) {
@@ -189,43 +226,109 @@ void Centipede::move(float dt, Grid grid) {
             }
         } else {
             if (horiState == HoriDirection::right) {
-                sf::Vector2f prevPos = sf::Vector2f(mCentipedeVect[0]->mSprite->getPosition().x, mCentipedeVect[0]->mSprite->getPosition().y);
-                mCentipedeVect[0]->mSprite->setPosition(sf::Vector2f(mCentipedeVect[0]->mSprite->getPosition().x + 16, mCentipedeVect[0]->mSprite->getPosition().y));
-
-                for (int i = 1; i < mLength; i++) {
-                    sf::Vector2f currentPos = sf::Vector2f(mCentipedeVect[i]->mSprite->getPosition().x, mCentipedeVect[i]->mSprite->getPosition().y);
-                    mCentipedeVect[i]->mSprite->setPosition(prevPos);
-                    prevPos = currentPos;
-                }
+                step(sf::Vector2f(16, 0));
             } else if (horiState == HoriDirection::left) {
-                sf::Vector2f prevPos = sf::Vector2f(mCentipedeVect[0]->mSprite->getPosition().x, mCentipedeVect[0]->mSprite->getPosition().y);
-                mCentipedeVect[0]->mSprite->setPosition(sf::Vector2f(mCentipedeVect[0]->mSprite->getPosition().x - 16, mCentipedeVect[0]->mSprite->getPosition().y));
-
-                for (int i = 1; i < mLength; i++) {
-                    sf::Vector2f currentPos = sf::Vector2f(mCentipedeVect[i]->mSprite->getPosition().x, mCentipedeVect[i]->mSprite->getPosition().y);
-                    mCentipedeVect[i]->mSprite->setPosition(prevPos);
-                    prevPos = currentPos;
-                }
+                step(sf::Vector2f(-16, 0));
             }
         }
     }
 }
 
 /**
- * @brief Causes Centipede to fall the ground
+ * @brief Moves the head by offset, every other segment into the place
+ *        of the one in front of it
+ * 
+ * @param offset Head movement in pixels
  */
-void Centipede::fall() {
+void Centipede::step(sf::Vector2f offset) {
+    sf::Vector2f prevPos = mCentipedeVect[0]->mSprite->getPosition();
+    mCentipedeVect[0]->mSprite->setPosition(prevPos + offset);
 
+    for (std::size_t i = 1; i < mCentipedeVect.size(); i++) {
+        sf::Vector2f currentPos = mCentipedeVect[i]->mSprite->getPosition();
+        mCentipedeVect[i]->mSprite->setPosition(prevPos);
+        prevPos = currentPos;
+    }
 }
 
 /**
- * @brief 
+ * @brief Writes the chain: spawn position, segment positions (as deltas),
+ *        heading and move timer
  * 
+ * @param out Save state being written
  */
-void Centipede::update(float dt) {
-    for (int i = 0; i < mLength; i++) {
-        mCentipedeVect[i]->mSprite->update(dt);
+void Centipede::saveState(SaveWriter& out) const {
+    sf::Vector2f last;
+    out.writeDelta(mPosition, last);
+    out.writeVarint(mCentipedeVect.size());
+    for (const segment* seg : mCentipedeVect) {
+        out.writeDelta(seg->mSprite->getPosition(), last);
+    }
+
+    std::uint8_t flags = (vertState == VertDirection::down ? 1 : 0) |
+                         (horiState == HoriDirection::right ? 2 : 0) |
+                         (diving ? 4 : 0);
+    out.writeByte(flags);
+    out.writeFloat(elapsedTime);
+}
+
+/**
+ * @brief Feeds the chain into the tick checksum: the chain itself, then
+ *        one entity per segment
+ * 
+ * @param sum Checksum of the current tick
+ * @param chain Index of the chain in Game's list
+ */
+void Centipede::hashState(StateChecksum& sum, int chain) const {
+    sum.beginEntity("centipede", chain);
+    sum.addVector(mPosition);
+    sum.add(static_cast<std::uint64_t>(vertState) | static_cast<std::uint64_t>(horiState) << 1 |
+            static_cast<std::uint64_t>(diving) << 2);
+    sum.addFloat(elapsedTime);
+    sum.add(mCentipedeVect.size());
+
+    for (std::size_t i = 0; i < mCentipedeVect.size(); i++) {
+        sum.beginEntity("segment", chain, static_cast<int>(i));
+        sum.addVector(mCentipedeVect[i]->mSprite->getPosition());
+    }
+}
+
+/**
+ * @brief Builds a chain from a save state
+ * 
+ * @param in Save state being read
+ * @param texture Atlas for the segments
+ * @return New chain, or nullptr if the section is damaged
+ */
+Centipede* Centipede::loadState(SaveReader& in, sf::Texture& texture) {
+    sf::Vector2f last;
+    sf::Vector2f position = in.readDelta(last);
+    std::vector<sf::Vector2f> segments(in.readCount(MAX_LENGTH));
+    for (sf::Vector2f& segmentPosition : segments) {
+        segmentPosition = in.readDelta(last);
+    }
+    std::uint8_t flags = in.readByte();
+    float elapsed = in.readFloat();
+    if (!in.ok()) {
+        return nullptr;
+    }
+
+    Centipede* chain = new Centipede(texture, static_cast<int>(segments.size()), position, sf::Vector2i(2, 2));
+    for (std::size_t i = 0; i < segments.size(); i++) {
+        chain->mCentipedeVect[i]->mSprite->setPosition(segments[i]);
     }
+    chain->vertState = (flags & 1) ? VertDirection::down : VertDirection::up;
+    chain->horiState = (flags & 2) ? HoriDirection::right : HoriDirection::left;
+    chain->diving = (flags & 4) != 0;
+    chain->elapsedTime = elapsed;
+    return chain;
+}
+
+/**
+ * @brief Causes Centipede to fall the ground
+ */
+void Centipede::fall() {
+
 }
 
 /**
@@ -235,7 +338,12 @@ void Centipede::update(float dt) {
  * @param states 
  */
 void Centipede::draw(sf::RenderTarget& target,sf::RenderStates states) const {
+    // Skip segments outside the target's current view
+    const sf::View& view = target.getView();
+    sf::FloatRect visible(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+
     for (int i = 0; i < mLength; i++) {
+        if (!mCentipedeVect[i]->mSprite->getBounds().intersects(visible)) continue;
         target.draw(mCentipedeVect[i]->mSprite->getSprite(), states);
     }
 }
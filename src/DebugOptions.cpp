@@ -0,0 +1,80 @@
+/**
+ * @file DebugOptions.cpp
+ * @author Ian Codding II
+ * @brief Command line parsing for DebugOptions
+ * @version 1.0
+ * @date 2025-12-12
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include "../includes/DebugOptions.h"
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+/**
+ * @brief Read switches from the command line
+ * @param argc Argument count from main()
+ * @param argv Arguments from main()
+ * @return Options with every recognised switch applied
+ */
+DebugOptions DebugOptions::parse(int argc, char *argv[]) {
+    DebugOptions options;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+
+        if (arg == "--stress") {
+            options.stress = true;
+            std::cout << "[DebugOptions] Stress mode on" << std::endl;
+        } else if (arg == "--cpu-log") {
+            options.cpuLog = true;
+            std::cout << "[DebugOptions] CPU usage log on" << std::endl;
+        } else if (arg == "--latency-log") {
+            options.latencyLog = true;
+            std::cout << "[DebugOptions] Input-to-present latency log on" << std::endl;
+        } else if (arg == "--frame-stats") {
+            options.frameStats = true;
+            std::cout << "[DebugOptions] Frame-time statistics on exit" << std::endl;
+        } else if (arg == "--fps" && i + 1 < argc) {
+            int rate = std::atoi(argv[++i]);
+            if (rate >= 10 && rate <= 1000) {
+                options.frameRate = static_cast<unsigned>(rate);
+                std::cout << "[DebugOptions] Frame rate " << options.frameRate << " FPS" << std::endl;
+            } else {
+                std::cerr << "[DebugOptions] --fps must be between 10 and 1000, keeping "
+                          << options.frameRate << std::endl;
+            }
+        } else if (arg == "--rewind") {
+            options.rewind = true;
+            std::cout << "[DebugOptions] Rewind on (hold Backspace in game)" << std::endl;
+        } else if (arg == "--checksum" && i + 1 < argc) {
+            options.checksumFile = argv[++i];
+            std::cout << "[DebugOptions] State checksum log " << options.checksumFile << " (fixed tick)" << std::endl;
+        } else if (arg == "--seed" && i + 1 < argc) {
+            options.seed = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+            std::cout << "[DebugOptions] Random seed " << options.seed << std::endl;
+        } else if (arg == "--world" && i + 1 < argc) {
+            unsigned width = 0, height = 0;
+            char separator = 0;
+            std::istringstream size(argv[++i]);
+            if (size >> width >> separator >> height && separator == 'x' && width >= 1 && width <= 64 &&
+                height >= 1 && height <= 64) {
+                options.worldWidth = width;
+                options.worldHeight = height;
+                std::cout << "[DebugOptions] World " << width << "x" << height << " fields" << std::endl;
+            } else {
+                std::cerr << "[DebugOptions] --world must be WxH with 1..64 fields each, keeping 1x1" << std::endl;
+            }
+        } else if (arg == "--resume" && i + 1 < argc) {
+            options.resumeFile = argv[++i];
+            std::cout << "[DebugOptions] Suspend/resume file " << options.resumeFile << std::endl;
+        } else {
+            std::cerr << "[DebugOptions] Unknown option: " << arg << std::endl;
+        }
+    }
+
+    return options;
+}
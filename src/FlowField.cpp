@@ -0,0 +1,55 @@
+/**
+ * @file    FlowField.cpp
+ * @author  Balin Becker
+ * @brief   Centipede move table definitions
+ * @date    2025-12-12
+ */
+
+#include "../includes/FlowField.h"
+
+/**
+ * @brief Table for an empty grid: heads only turn at the edges
+ */
+FlowField::FlowField(int columns, int rows)
+    : mColumns(columns),
+      mMoves(static_cast<std::size_t>(columns) * rows * 4) {
+    for (int row = 0; row < rows; row++) {
+        for (int column = 0; column < columns; column++) {
+            setAhead(column, row, false, column == 0);
+            setAhead(column, row, true, column == columns - 1);
+        }
+    }
+}
+
+/**
+ * @brief Update the heads whose look-ahead is this cell
+ * 
+ * @param occupied Whether the cell now holds a mushroom
+ * @param poisoned Whether that mushroom is poisoned
+ */
+void FlowField::cellChanged(int column, int row, bool occupied, bool poisoned) {
+    if (column > 0) {
+        setAhead(column - 1, row, true, occupied, occupied && poisoned);
+    }
+    if (column < mColumns - 1) {
+        setAhead(column + 1, row, false, occupied, occupied && poisoned);
+    }
+}
+
+/**
+ * @brief Write both vertical variants for one cell and heading
+ * 
+ * @param blocked Whether the cell ahead is a mushroom or off the grid
+ * @param poisoned Whether that mushroom is poisoned
+ */
+void FlowField::setAhead(int column, int row, bool right, bool blocked, bool poisoned) {
+    std::size_t base = (static_cast<std::size_t>(row) * mColumns + column) * 4 + (right ? 2 : 0);
+    Move forward = right ? Move::Right : Move::Left;
+
+    if (poisoned) {
+        mMoves[base] = mMoves[base + 1] = Move::Dive;
+        return;
+    }
+    mMoves[base] = blocked ? Move::Up : forward;
+    mMoves[base + 1] = blocked ? Move::Down : forward;
+}
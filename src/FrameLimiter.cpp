@@ -0,0 +1,154 @@
+/**
+ * @file FrameLimiter.cpp
+ * @author Ian Codding II
+ * @brief Hybrid sleep/spin waiting and frame-time histograms
+ * @version 1.0
+ * @date 2025-12-15
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include "../includes/FrameLimiter.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+// ===== FRAME TIME HISTOGRAM =====
+
+/**
+ * @brief Empty histogram
+ */
+FrameTimeHistogram::FrameTimeHistogram()
+    : buckets(MAX_TRACKED_US / BUCKET_US + 1, 0),
+      samples(0),
+      longest(0) {
+}
+
+/**
+ * @brief Count one frame time
+ */
+void FrameTimeHistogram::add(std::uint64_t micros) {
+    std::size_t bucket = static_cast<std::size_t>(std::min(micros, MAX_TRACKED_US) / BUCKET_US);
+    buckets[bucket]++;
+    samples++;
+    longest = std::max(longest, micros);
+}
+
+/**
+ * @brief Forget every sample
+ */
+void FrameTimeHistogram::clear() {
+    std::fill(buckets.begin(), buckets.end(), 0);
+    samples = 0;
+    longest = 0;
+}
+
+/**
+ * @brief Walk the buckets until the fraction of frames is covered
+ * @return Upper edge of that bucket in microseconds (never above max())
+ */
+std::uint64_t FrameTimeHistogram::percentile(double fraction) const {
+    if (samples == 0) {
+        return 0;
+    }
+
+    std::uint64_t wanted = static_cast<std::uint64_t>(fraction * samples);
+    wanted = std::max<std::uint64_t>(1, std::min(wanted, samples));
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < buckets.size(); i++) {
+        seen += buckets[i];
+        if (seen >= wanted) {
+            return std::min((i + 1) * BUCKET_US, longest);
+        }
+    }
+    return longest;
+}
+
+/**
+ * @brief Log the percentiles
+ */
+void FrameTimeHistogram::print(const std::string &label) const {
+    if (samples == 0) {
+        std::cout << "[FrameLimiter] " << label << ": no frames" << std::endl;
+        return;
+    }
+
+    std::cout << "[FrameLimiter] " << label << " frame times: p50 " << percentile(0.50) / 1000.0
+              << " ms | p95 " << percentile(0.95) / 1000.0 << " ms | p99 " << percentile(0.99) / 1000.0
+              << " ms | max " << longest / 1000.0 << " ms | frames " << samples << std::endl;
+}
+
+// ===== FRAME LIMITER =====
+
+/**
+ * @brief Limiter for the given rate, schedule starting now
+ */
+FrameLimiter::FrameLimiter(unsigned hz)
+    : rate(0),
+      period(0),
+      nextFrame(0),
+      lastFrame(0) {
+    setRate(hz);
+    restart();
+}
+
+/**
+ * @brief Change the target rate (takes effect from the next frame)
+ */
+void FrameLimiter::setRate(unsigned hz) {
+    rate = std::max(1u, hz);
+    period = 1000000 / rate;
+}
+
+/**
+ * @brief Wait out the rest of the frame and record its length
+ *
+ * Deadlines advance by exactly one period, so a short overshoot is made
+ * up by the next frame. After a long stall the schedule restarts from now
+ * instead of rushing out frames to catch up.
+ */
+void FrameLimiter::wait() {
+    nextFrame += period;
+
+    std::uint64_t now = nowMicros();
+    if (now > nextFrame + period) {
+        nextFrame = now;
+    }
+
+    waitUntil(nextFrame);
+
+    now = nowMicros();
+    frameTimes.add(now - lastFrame);
+    lastFrame = now;
+}
+
+/**
+ * @brief New schedule from now; the time since the last frame is not recorded
+ */
+void FrameLimiter::restart() {
+    nextFrame = lastFrame = nowMicros();
+}
+
+/**
+ * @brief Coarse sleep to SPIN_US before the deadline, then spin to it
+ */
+void FrameLimiter::waitUntil(std::uint64_t micros) {
+    std::uint64_t now = nowMicros();
+    if (now + SPIN_US < micros) {
+        std::this_thread::sleep_for(std::chrono::microseconds(micros - SPIN_US - now));
+    }
+
+    while (nowMicros() < micros) {
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * @brief Steady clock in microseconds
+ */
+std::uint64_t FrameLimiter::nowMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
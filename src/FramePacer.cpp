@@ -0,0 +1,182 @@
+/**
+ * @file FramePacer.cpp
+ * @author Ian Codding II
+ * @brief Just-in-time frame scheduling and input-to-present measurement
+ * @version 1.0
+ * @date 2025-12-14
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include "../includes/FramePacer.h"
+#include <algorithm>
+#include <iostream>
+
+/**
+ * @brief Construct a pacer for the given present rate
+ * @param presentHz Presents per second
+ */
+FramePacer::FramePacer(unsigned presentHz)
+    : rate(presentHz),
+      period(1000000 / std::max(1u, presentHz)),
+      base(0),
+      renderIndex(0),
+      predictedRender(0),
+      renderStart(0),
+      lastPresent(0),
+      latencyLog(false),
+      loggedInput(0),
+      latencyTotal(0),
+      latencyMax(0),
+      latencySamples(0),
+      skippedFrames(0),
+      logStart(0),
+      simTarget(0),
+      simStarted(false),
+      simStart(0) {
+    reset();
+}
+
+/**
+ * @brief New schedule: present 1 is one period from now
+ *          Only call while the render thread is stopped
+ */
+void FramePacer::reset() {
+    base = nowMicros();
+    renderIndex = 1;
+    simTarget = 0;
+    simStarted = false;
+    logStart = base;
+    lastPresent = 0;
+}
+
+/**
+ * @brief Latest start time for drawing present index
+ */
+std::uint64_t FramePacer::renderLatch(std::uint64_t index) const {
+    return presentTime(index) - predictedRender.load(std::memory_order_relaxed) - MARGIN_US;
+}
+
+/**
+ * @brief Render thread - sleep until the next render latch
+ *
+ * If the present itself has already passed (a long stall), the presents
+ * that can no longer be made are skipped.
+ */
+void FramePacer::waitToRender() {
+    std::uint64_t index = renderIndex.load(std::memory_order_relaxed);
+    std::uint64_t now = nowMicros();
+
+    if (now > presentTime(index)) {
+        std::uint64_t late = (now - presentTime(index)) / period + 1;
+        index += late;
+        skippedFrames += late;
+        renderIndex.store(index, std::memory_order_release);
+    }
+
+    FrameLimiter::waitUntil(renderLatch(index));
+    renderStart = nowMicros();
+}
+
+/**
+ * @brief Render thread - measure the frame, move on to the next present
+ */
+void FramePacer::framePresented(std::uint64_t inputTime) {
+    std::uint64_t now = nowMicros();
+    renderCosts.add(now - renderStart);
+    if (lastPresent != 0) {
+        presentIntervals.add(now - lastPresent);
+    }
+    lastPresent = now;
+    predictedRender.store(renderCosts.predict(), std::memory_order_relaxed);
+    renderIndex.store(renderIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+    if (!latencyLog) {
+        return;
+    }
+
+    // Only the first frame showing a change counts
+    if (inputTime != 0 && inputTime != loggedInput && inputTime <= now) {
+        std::uint64_t latency = now - inputTime;
+        loggedInput = inputTime;
+        latencyTotal += latency;
+        latencyMax = std::max(latencyMax, latency);
+        latencySamples++;
+    }
+
+    double seconds = (now - logStart) / 1e6;
+    if (seconds >= LOG_SECONDS) {
+        std::cout << "[FramePacer] input-to-present: ";
+        if (latencySamples > 0) {
+            std::cout << "avg " << latencyTotal / 1000.0 / latencySamples << " ms | max "
+                      << latencyMax / 1000.0 << " ms | samples " << latencySamples;
+        } else {
+            std::cout << "no input";
+        }
+        std::cout << " | render est " << predictedRender.load() / 1000.0 << " ms | sim est "
+                  << simCosts.predict() / 1000.0 << " ms | skipped " << skippedFrames << std::endl;
+
+        latencyTotal = latencyMax = latencySamples = skippedFrames = 0;
+        logStart = now;
+    }
+}
+
+/**
+ * @brief Render thread - no frame yet, wait for the next present
+ */
+void FramePacer::skipFrame() {
+    renderIndex.store(renderIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Simulation thread - sleep until the tick for the next present must start
+ *
+ * Aims at the first present after the last one simulated whose render
+ * latch has not passed yet. If even that start time is gone, the tick
+ * runs right away.
+ */
+void FramePacer::waitToSimulate() {
+    std::uint64_t index = renderIndex.load(std::memory_order_acquire);
+    if (simStarted) {
+        index = std::max(index, simTarget + 1);
+    }
+
+    std::uint64_t now = nowMicros();
+    while (renderLatch(index) <= now) {
+        index++;
+    }
+
+    std::uint64_t cost = simCosts.predict() + MARGIN_US;
+    std::uint64_t latch = renderLatch(index);
+    if (latch > now + cost) {
+        FrameLimiter::waitUntil(latch - cost);
+    }
+
+    simTarget = index;
+    simStarted = true;
+    simStart = nowMicros();
+}
+
+/**
+ * @brief Simulation thread - measure the tick
+ */
+void FramePacer::simulationDone() {
+    if (simStarted) {
+        simCosts.add(nowMicros() - simStart);
+    }
+}
+
+/**
+ * @brief Add one duration, overwriting the oldest
+ */
+void FramePacer::CostWindow::add(std::uint64_t micros) {
+    samples[next] = static_cast<std::uint32_t>(std::min<std::uint64_t>(micros, 0xFFFFFFFFu));
+    next = (next + 1) % COST_WINDOW;
+}
+
+/**
+ * @brief Slowest recent duration
+ */
+std::uint64_t FramePacer::CostWindow::predict() const {
+    return *std::max_element(samples, samples + COST_WINDOW);
+}
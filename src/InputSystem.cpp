@@ -0,0 +1,175 @@
+/**
+ * @file InputSystem.cpp
+ * @author Ian Codding II
+ * @brief Input thread and per-tick snapshot building
+ * @version 1.0
+ * @date 2025-12-13
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include "../includes/InputSystem.h"
+#include "../includes/Profiler.h"
+#include <SFML/Window/Keyboard.hpp>
+#include <bitset>
+#include <chrono>
+#include <iostream>
+
+/**
+ * @brief Construct a stopped input system
+ */
+InputSystem::InputSystem()
+    : running(false),
+      held(0),
+      newestChange(0),
+      tickCount(0) {
+}
+
+/**
+ * @brief Stop the thread if it is still running
+ */
+InputSystem::~InputSystem() {
+    stop();
+}
+
+/**
+ * @brief Start the sampling thread
+ */
+void InputSystem::start() {
+    if (running) {
+        return;
+    }
+
+    running = true;
+    thread = std::thread(&InputSystem::inputLoop, this);
+
+    std::cout << "[InputSystem] Started (" << SAMPLE_HZ << " Hz)" << std::endl;
+}
+
+/**
+ * @brief Join the sampling thread
+ *          Changes still in the ring are picked up by the next beginTick()
+ */
+void InputSystem::stop() {
+    if (!running) {
+        return;
+    }
+
+    running = false;
+    thread.join();
+
+    std::cout << "[InputSystem] Stopped" << std::endl;
+}
+
+/**
+ * @brief Fold every queued change into one snapshot
+ *
+ * pressed collects the rising edges of every change, so a button pressed
+ * and released between two ticks is still reported once.
+ */
+InputSnapshot InputSystem::beginTick() {
+    InputSnapshot snapshot;
+    snapshot.tick = tickCount++;
+
+    if (!running) {
+        // No thread: the old frame-quantised polling
+        std::uint16_t buttons = sampleDevices();
+        if (buttons != held) {
+            newestChange = nowMicros();
+        }
+        snapshot.pressed = buttons & ~held;
+        snapshot.held = held = buttons;
+        snapshot.newestChange = newestChange;
+        return snapshot;
+    }
+
+    std::uint64_t now = nowMicros();
+    std::uint16_t pressed = 0;
+    InputEvent event;
+    while (ring.pop(event)) {
+        pressed |= event.buttons & ~held;
+        held = event.buttons;
+        newestChange = event.time;
+        profiler().record("input.latency_us", static_cast<double>(now - event.time));
+    }
+
+    // Pressed and already up again: polling at the frame would not have seen these
+    std::uint16_t taps = pressed & ~held;
+    if (taps != 0) {
+        profiler().record("input.short_taps", static_cast<double>(std::bitset<16>(taps).count()));
+    }
+
+    snapshot.held = held;
+    snapshot.pressed = pressed;
+    snapshot.newestChange = newestChange;
+    return snapshot;
+}
+
+/**
+ * @brief Drop queued changes, keeping only the newest held state
+ */
+void InputSystem::discard() {
+    InputEvent event;
+    while (ring.pop(event)) {
+        held = event.buttons;
+        newestChange = event.time;
+    }
+}
+
+/**
+ * @brief Read the gameplay keys
+ */
+std::uint16_t InputSystem::sampleDevices() {
+    std::uint16_t buttons = 0;
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::A) || sf::Keyboard::isKeyPressed(sf::Keyboard::Left))
+        buttons |= INPUT_LEFT;
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::D) || sf::Keyboard::isKeyPressed(sf::Keyboard::Right))
+        buttons |= INPUT_RIGHT;
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::W) || sf::Keyboard::isKeyPressed(sf::Keyboard::Up))
+        buttons |= INPUT_UP;
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::S) || sf::Keyboard::isKeyPressed(sf::Keyboard::Down))
+        buttons |= INPUT_DOWN;
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space))
+        buttons |= INPUT_FIRE;
+    return buttons;
+}
+
+/**
+ * @brief Input thread - sample, push changes, sleep until the next sample
+ *
+ * A change that does not fit in a full ring is retried on the next sample,
+ * so the consumer always ends up with the current state.
+ */
+void InputSystem::inputLoop() {
+    const std::chrono::microseconds period(1000000 / SAMPLE_HZ);
+    std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now();
+    bool havePushed = false;
+    std::uint16_t lastPushed = 0;
+
+    while (running) {
+        InputEvent event;
+        event.buttons = sampleDevices();
+        event.time = nowMicros();
+
+        if ((!havePushed || event.buttons != lastPushed) && ring.push(event)) {
+            lastPushed = event.buttons;
+            havePushed = true;
+        }
+
+        // Fixed rate; after a long stall start again from now instead of catching up
+        next += period;
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (next < now) {
+            next = now;
+        }
+        std::this_thread::sleep_until(next);
+    }
+}
+
+/**
+ * @brief Steady clock in microseconds
+ */
+std::uint64_t InputSystem::nowMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,217 @@
+/**
+ * @file JobSystem.cpp
+ * @author Ian Codding II
+ * @brief Implementation of the work-stealing job system
+ * @version 1.0
+ * @date 2025-12-08
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include "../includes/JobSystem.h"
+#include "../includes/errorHandler.h"
+#include <algorithm>
+#include <exception>
+#include <iostream>
+
+/**
+ * @brief Constructor - create one deque per thread and start the workers
+ *
+ * @param workerCount Threads to create, 0 = hardware_concurrency() - 1
+ */
+JobSystem::JobSystem(unsigned workerCount)
+    : remainingJobs(0),
+      queuedJobs(0),
+      stopping(false) {
+    if (workerCount == 0) {
+        unsigned cores = std::thread::hardware_concurrency();
+        workerCount = cores > 1 ? cores - 1 : 0;
+    }
+
+    // Deque 0 is for the thread that calls run()
+    queues.resize(workerCount + 1);
+
+    for (unsigned i = 1; i <= workerCount; i++) {
+        workers.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+
+    std::cout << "[JobSystem] Started " << workerCount << " worker threads" << std::endl;
+}
+
+/**
+ * @brief Destructor - wake every worker and join them
+ */
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        stopping = true;
+    }
+    wake.notify_all();
+
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Create a job for the current graph
+ */
+JobSystem::Job *JobSystem::createJob(std::function<void()> task) {
+    graph.emplace_back();
+    Job *job = &graph.back();
+    job->task = std::move(task);
+    return job;
+}
+
+/**
+ * @brief Make job wait until prerequisite has finished
+ */
+void JobSystem::addDependency(Job *job, Job *prerequisite) {
+    prerequisite->continuations.push_back(job);
+    job->pendingDeps++;
+}
+
+/**
+ * @brief Split [0, count) into chunk jobs plus one job that joins them
+ */
+JobSystem::Job *JobSystem::parallelFor(std::size_t count, std::size_t grain,
+                                       std::function<void(std::size_t, std::size_t)> body) {
+    Job *done = createJob(nullptr);
+    if (grain == 0) {
+        grain = 1;
+    }
+
+    for (std::size_t begin = 0; begin < count; begin += grain) {
+        std::size_t end = std::min(count, begin + grain);
+        Job *chunk = createJob([body, begin, end]() { body(begin, end); });
+        addDependency(done, chunk);
+    }
+
+    return done;
+}
+
+/**
+ * @brief Execute the graph and wait for it
+ *
+ * Ready jobs are dealt round-robin over the deques so workers start
+ * without having to steal. The calling thread then works from deque 0
+ * until nothing is left.
+ */
+void JobSystem::run() {
+    if (graph.empty()) {
+        return;
+    }
+
+    remainingJobs = static_cast<int>(graph.size());
+
+    // Collect the roots before pushing any, otherwise a worker could
+    // release a continuation that this loop would then push a second time
+    std::vector<Job *> ready;
+    for (Job &job : graph) {
+        if (job.pendingDeps == 0) {
+            ready.push_back(&job);
+        }
+    }
+
+    for (std::size_t i = 0; i < ready.size(); i++) {
+        push(i % queues.size(), ready[i]);
+    }
+
+    while (remainingJobs > 0) {
+        Job *job = findJob(0);
+        if (job != nullptr) {
+            execute(0, job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    graph.clear();
+}
+
+/**
+ * @brief Worker thread body - run jobs, sleep when there are none
+ */
+void JobSystem::workerLoop(unsigned index) {
+    while (true) {
+        Job *job = findJob(index);
+        if (job != nullptr) {
+            execute(index, job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> guard(sleepLock);
+        wake.wait(guard, [this]() { return stopping || queuedJobs > 0; });
+        if (stopping) {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Put a job at the back of a thread's deque and wake a sleeper
+ */
+void JobSystem::push(unsigned index, Job *job) {
+    {
+        std::lock_guard<std::mutex> guard(queues[index].lock);
+        queues[index].jobs.push_back(job);
+    }
+    {
+        // Counted under sleepLock so a worker can't miss the wake-up
+        std::lock_guard<std::mutex> guard(sleepLock);
+        queuedJobs++;
+    }
+    wake.notify_one();
+}
+
+/**
+ * @brief Pop from our own deque, otherwise steal from another one
+ */
+JobSystem::Job *JobSystem::findJob(unsigned index) {
+    {
+        WorkQueue &own = queues[index];
+        std::lock_guard<std::mutex> guard(own.lock);
+        if (!own.jobs.empty()) {
+            Job *job = own.jobs.back();
+            own.jobs.pop_back();
+            queuedJobs--;
+            return job;
+        }
+    }
+
+    for (std::size_t offset = 1; offset < queues.size(); offset++) {
+        WorkQueue &victim = queues[(index + offset) % queues.size()];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (!victim.jobs.empty()) {
+            Job *job = victim.jobs.front();
+            victim.jobs.pop_front();
+            queuedJobs--;
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+/**
+ * @brief Run a job, then release the jobs that were waiting on it
+ *
+ * Released jobs go on this thread's deque so they run hot in cache.
+ */
+void JobSystem::execute(unsigned index, Job *job) {
+    if (job->task) {
+        try {
+            job->task();
+        } catch (const std::exception &e) {
+            logError("JobSystem", std::string("Job threw: ") + e.what());
+        }
+    }
+
+    for (Job *next : job->continuations) {
+        if (--next->pendingDeps == 0) {
+            push(index, next);
+        }
+    }
+
+    remainingJobs--;
+}
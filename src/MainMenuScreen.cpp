@@ -198,6 +198,17 @@ void MainMenuScreen::initialize() {
     confirmNoButton->setColorTextNormal(sf::Color::Black);
     confirmNoButton->setColorTextHover(sf::Color::Yellow);
     std::cout << "[MainMenuScreen] Created Confirm No button" << std::endl;
+
+    // Cache the button rectangles for hit-testing
+    menuButtons.clear();
+    menuButtons.add(startButton);
+    menuButtons.add(leaderboardButton);
+    menuButtons.add(settingsButton);
+    menuButtons.add(quitButton);
+
+    dialogButtons.clear();
+    dialogButtons.add(confirmYesButton);
+    dialogButtons.add(confirmNoButton);
 }
 
 /**
@@ -210,8 +221,8 @@ void MainMenuScreen::initialize() {
  * If quit dialog is showing, only the Yes/No confirmation buttons work.
  * Otherwise, the main 4 buttons are active.
  * 
- * Note: Button::update() takes (sf::Event&, sf::RenderWindow&)
- * Note: Button::getState() returns: normal, hovered, or clicked
+ * Note: ButtonGroup::handleEvent() returns the button a click landed on
+ *       (hover changes are resolved once per frame in flushInput())
  * 
  * @param event The SFML event to process
  * @return The next state to transition to (or current state to stay)
@@ -220,74 +231,69 @@ GameState MainMenuScreen::update(sf::Event& event) {
     // Check if quit confirmation dialog is showing
     if (showQuitDialog) {
         // Dialog is active, so only Yes/No buttons should work
-        
-        // Update the Yes button and check if clicked
-        if (confirmYesButton != nullptr) {
-            confirmYesButton->update(event, window);
-            if (confirmYesButton->getState() == clicked) {
-                std::cout << "[MainMenuScreen] Quit confirmed - closing window" << std::endl;
-                window.close();
-                return GameState::MENU; // Won't matter, window is closed
-            }
+        Button* pressed = dialogButtons.handleEvent(event, window);
+
+        if (pressed != nullptr && pressed == confirmYesButton) {
+            std::cout << "[MainMenuScreen] Quit confirmed - closing window" << std::endl;
+            window.close();
+            return GameState::MENU; // Won't matter, window is closed
         }
-        
-        // Update the No button and check if clicked
-        if (confirmNoButton != nullptr) {
-            confirmNoButton->update(event, window);
-            if (confirmNoButton->getState() == clicked) {
-                std::cout << "[MainMenuScreen] Quit cancelled" << std::endl;
-                showQuitDialog = false; // Hide dialog, stay in menu
-                return GameState::MENU;
-            }
+
+        if (pressed != nullptr && pressed == confirmNoButton) {
+            std::cout << "[MainMenuScreen] Quit cancelled" << std::endl;
+            showQuitDialog = false; // Hide dialog, stay in menu
+            markDirty();
+            menuButtons.resync();   // It missed every mouse move while hidden
+            return GameState::MENU;
         }
         
         // If we got here, no button was clicked while dialog is open
         return GameState::MENU;
     }
     
-    // Dialog is NOT showing, so update the main menu buttons
-    
-    // Update START GAME button
-    if (startButton != nullptr) {
-        startButton->update(event, window);
-        if (startButton->getState() == clicked) {
-            std::cout << "[MainMenuScreen] Start Game clicked - transitioning to PLAYING" << std::endl;
-            return GameState::PLAYING;
-        }
+    // Dialog is NOT showing, so only the main menu buttons work
+    Button* pressed = menuButtons.handleEvent(event, window);
+    if (pressed == nullptr) {
+        // No button was clicked, stay in MENU
+        return GameState::MENU;
     }
-    
-    // Update LEADERBOARD button
-    if (leaderboardButton != nullptr) {
-        leaderboardButton->update(event, window);
-        if (leaderboardButton->getState() == clicked) {
-            std::cout << "[MainMenuScreen] Leaderboard clicked" << std::endl;
-            return GameState::LEADERBOARD;
-        }
+
+    if (pressed == startButton) {
+        std::cout << "[MainMenuScreen] Start Game clicked - transitioning to PLAYING" << std::endl;
+        return GameState::PLAYING;
     }
-    
-    // Update SETTINGS button
-    if (settingsButton != nullptr) {
-        settingsButton->update(event, window);
-        if (settingsButton->getState() == clicked) {
-            std::cout << "[MainMenuScreen] Settings clicked" << std::endl;
-            return GameState::SETTINGS;
-        }
+    if (pressed == leaderboardButton) {
+        std::cout << "[MainMenuScreen] Leaderboard clicked" << std::endl;
+        return GameState::LEADERBOARD;
     }
-    
-    // Update QUIT button
-    if (quitButton != nullptr) {
-        quitButton->update(event, window);
-        if (quitButton->getState() == clicked) {
-            std::cout << "[MainMenuScreen] Quit clicked - showing confirmation dialog" << std::endl;
-            showQuitDialog = true; // Show the confirmation dialog
-            return GameState::MENU; // Stay in menu
-        }
+    if (pressed == settingsButton) {
+        std::cout << "[MainMenuScreen] Settings clicked" << std::endl;
+        return GameState::SETTINGS;
+    }
+    if (pressed == quitButton) {
+        std::cout << "[MainMenuScreen] Quit clicked - showing confirmation dialog" << std::endl;
+        showQuitDialog = true;    // Show the confirmation dialog
+        markDirty();
+        dialogButtons.resync();
+        return GameState::MENU;   // Stay in menu
     }
     
-    // No button was clicked, stay in MENU
     return GameState::MENU;
 }
 
+/**
+ * @brief Flush input - hit-test the mouse once per frame
+ * 
+ * Mouse moves are only stored by update(); the active button group
+ * resolves the hover here, once, for however many moves arrived.
+ */
+void MainMenuScreen::flushInput() {
+    ButtonGroup& active = showQuitDialog ? dialogButtons : menuButtons;
+    if (active.flush(window)) {
+        markDirty();
+    }
+}
+
 /**
  * @brief Render - draw the main menu screen
  * 
@@ -402,6 +408,10 @@ void MainMenuScreen::renderQuitDialog() {
  */
 void MainMenuScreen::cleanup() {
     std::cout << "[MainMenuScreen] cleanup() called" << std::endl;
+
+    // The groups only point at the buttons, forget them first
+    menuButtons.clear();
+    dialogButtons.clear();
     
     // Delete each button if it exists
     if (startButton != nullptr) {
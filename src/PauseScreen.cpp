@@ -164,6 +164,16 @@ void PauseScreen::initialize() {
     confirmNoButton->setColorTextNormal(sf::Color::Black);
     confirmNoButton->setColorTextHover(sf::Color::Yellow);
     std::cout << "[PauseScreen] Created Confirm No button" << std::endl;
+
+    // Cache the button rectangles for hit-testing
+    menuButtons.clear();
+    menuButtons.add(resumeButton);
+    menuButtons.add(mainMenuButton);
+    menuButtons.add(quitButton);
+
+    dialogButtons.clear();
+    dialogButtons.add(confirmYesButton);
+    dialogButtons.add(confirmNoButton);
 }
 
 /**
@@ -172,7 +182,7 @@ void PauseScreen::initialize() {
  * If quit dialog is showing, only Yes/No buttons respond.
  * Otherwise, the three pause menu buttons are active.
  * 
- * Note: Button::update() takes (sf::Event&, sf::RenderWindow&)
+ * Note: ButtonGroup::handleEvent() returns the button a click landed on
  * 
  * Return states:
  * - PLAYING: Continue game (Resume clicked)
@@ -187,62 +197,63 @@ GameState PauseScreen::update(sf::Event& event) {
     // Check if quit confirmation dialog is showing
     if (showQuitDialog) {
         // Dialog is active, only Yes/No buttons work
-        
-        if (confirmYesButton != nullptr) {
-            confirmYesButton->update(event, window);
-            if (confirmYesButton->getState() == clicked) {
-                std::cout << "[PauseScreen] Quit confirmed" << std::endl;
-                window.close();
-                return GameState::PAUSED; // Won't matter, window closed
-            }
+        Button* pressed = dialogButtons.handleEvent(event, window);
+
+        if (pressed != nullptr && pressed == confirmYesButton) {
+            std::cout << "[PauseScreen] Quit confirmed" << std::endl;
+            window.close();
+            return GameState::PAUSED; // Won't matter, window closed
         }
-        
-        if (confirmNoButton != nullptr) {
-            confirmNoButton->update(event, window);
-            if (confirmNoButton->getState() == clicked) {
-                std::cout << "[PauseScreen] Quit cancelled" << std::endl;
-                showQuitDialog = false;
-                return GameState::PAUSED;
-            }
+
+        if (pressed != nullptr && pressed == confirmNoButton) {
+            std::cout << "[PauseScreen] Quit cancelled" << std::endl;
+            showQuitDialog = false;
+            markDirty();
+            menuButtons.resync();   // It missed every mouse move while hidden
+            return GameState::PAUSED;
         }
         
         return GameState::PAUSED;
     }
     
-    // Dialog is NOT showing, update main pause menu buttons
-    
-    // Update RESUME button
-    if (resumeButton != nullptr) {
-        resumeButton->update(event, window);
-        if (resumeButton->getState() == clicked) {
-            std::cout << "[PauseScreen] Resume clicked - returning to gameplay" << std::endl;
-            return GameState::PLAYING;
-        }
+    // Dialog is NOT showing, only the main pause menu buttons work
+    Button* pressed = menuButtons.handleEvent(event, window);
+    if (pressed == nullptr) {
+        // No button clicked, stay paused
+        return GameState::PAUSED;
     }
-    
-    // Update MAIN MENU button
-    if (mainMenuButton != nullptr) {
-        mainMenuButton->update(event, window);
-        if (mainMenuButton->getState() == clicked) {
-            std::cout << "[PauseScreen] Main Menu clicked - transitioning to menu" << std::endl;
-            return GameState::MENU;
-        }
+
+    if (pressed == resumeButton) {
+        std::cout << "[PauseScreen] Resume clicked - returning to gameplay" << std::endl;
+        return GameState::PLAYING;
     }
-    
-    // Update QUIT button
-    if (quitButton != nullptr) {
-        quitButton->update(event, window);
-        if (quitButton->getState() == clicked) {
-            std::cout << "[PauseScreen] Quit clicked - showing confirmation" << std::endl;
-            showQuitDialog = true;
-            return GameState::PAUSED;
-        }
+    if (pressed == mainMenuButton) {
+        std::cout << "[PauseScreen] Main Menu clicked - transitioning to menu" << std::endl;
+        return GameState::MENU;
+    }
+    if (pressed == quitButton) {
+        std::cout << "[PauseScreen] Quit clicked - showing confirmation" << std::endl;
+        showQuitDialog = true;
+        markDirty();
+        dialogButtons.resync();
+        return GameState::PAUSED;
     }
     
-    // No button clicked, stay paused
     return GameState::PAUSED;
 }
 
+/**
+ * @brief Flush input - hit-test the mouse once per frame
+ * 
+ * Only the group that is currently active (menu or dialog) is tested.
+ */
+void PauseScreen::flushInput() {
+    ButtonGroup& active = showQuitDialog ? dialogButtons : menuButtons;
+    if (active.flush(window)) {
+        markDirty();
+    }
+}
+
 /**
  * @brief Render - draw the pause screen
  * 
@@ -340,6 +351,10 @@ void PauseScreen::renderQuitDialog() {
  */
 void PauseScreen::cleanup() {
     std::cout << "[PauseScreen] cleanup() called" << std::endl;
+
+    // The groups only point at the buttons, forget them first
+    menuButtons.clear();
+    dialogButtons.clear();
     
     if (resumeButton != nullptr) {
         delete resumeButton;
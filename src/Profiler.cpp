@@ -0,0 +1,53 @@
+/**
+ * @file Profiler.cpp
+ * @author Ian Codding II
+ * @brief Implementation of the frame counter profiler
+ * @version 1.0
+ * @date 2025-12-12
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include "../includes/Profiler.h"
+#include <algorithm>
+#include <iostream>
+
+/**
+ * @brief Add one sample to a counter
+ * @param name Counter name
+ * @param value This frame's value
+ */
+void Profiler::record(const std::string &name, double value) {
+    Stat &stat = stats[name];
+    if (stat.samples == 0) {
+        stat.max = value;
+    }
+    stat.total += value;
+    stat.max = std::max(stat.max, value);
+    stat.samples++;
+}
+
+/**
+ * @brief Log every counter recorded since the last print
+ * Counters without samples in this window are skipped.
+ */
+void Profiler::print() {
+    for (auto &entry : stats) {
+        Stat &stat = entry.second;
+        if (stat.samples == 0) {
+            continue;
+        }
+
+        std::cout << "[Profiler] " << entry.first << ": avg " << stat.total / stat.samples
+                  << " | max " << stat.max << " | samples " << stat.samples << std::endl;
+        stat = Stat();
+    }
+}
+
+/**
+ * @brief Shared profiler
+ */
+Profiler &profiler() {
+    static Profiler instance;
+    return instance;
+}
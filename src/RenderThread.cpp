@@ -0,0 +1,475 @@
+/**
+ * @file RenderThread.cpp
+ * @author Ian Codding II
+ * @brief Implementation of the snapshot-consuming render thread
+ * @version 1.0
+ * @date 2025-12-08
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include "../includes/RenderThread.h"
+#include <SFML/OpenGL.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Constructor - set up the HUD text the render thread owns
+ * @param win Window to draw to
+ * @param fnt Shared font for the HUD
+ */
+RenderThread::RenderThread(sf::RenderWindow &win, sf::Font &fnt, FramePacer &framePacer)
+    : window(win),
+      pacer(framePacer),
+      writeIndex(0),
+      readIndex(2),
+      latest(1),
+      running(false),
+      batch(sf::Triangles),
+      particleBatch(sf::Triangles),
+      shownScore(-1),
+      shownLives(-1),
+      shownLevel(-1),
+      layersSupported(true),
+      layerSession(0),
+      layerSequence(0),
+      layerBatch(sf::Triangles),
+      mushroomAck(0) {
+    scoreText.setFont(fnt);
+    scoreText.setCharacterSize(20);
+    scoreText.setFillColor(sf::Color::Green);
+    scoreText.setPosition(10, 10);
+
+    livesText.setFont(fnt);
+    livesText.setCharacterSize(20);
+    livesText.setFillColor(sf::Color::Green);
+    livesText.setPosition(window.getSize().x - 200, 10);
+
+    levelText.setFont(fnt);
+    levelText.setCharacterSize(20);
+    levelText.setFillColor(sf::Color::Green);
+    levelText.setPosition(window.getSize().x / 2 - 50, 10);
+}
+
+/**
+ * @brief Destructor - make sure the thread is gone
+ */
+RenderThread::~RenderThread() {
+    stop();
+}
+
+/**
+ * @brief Release the OpenGL context here and start drawing on a new thread
+ *
+ * Any frame left over from a previous session is dropped, since its atlas
+ * may belong to a Game that no longer exists.
+ */
+void RenderThread::start() {
+    if (running) {
+        return;
+    }
+
+    latest = latest & ~FRESH_FRAME;
+    shownScore = shownLives = shownLevel = -1;
+
+    // The pacer times presents from here on
+    pacer.reset();
+
+    window.setActive(false);
+    running = true;
+    thread = std::thread(&RenderThread::renderLoop, this);
+
+    std::cout << "[RenderThread] Started" << std::endl;
+}
+
+/**
+ * @brief Join the render thread and take the OpenGL context back
+ */
+void RenderThread::stop() {
+    if (!running) {
+        return;
+    }
+
+    running = false;
+    thread.join();
+    window.setActive(true);
+
+    std::cout << "[RenderThread] Stopped" << std::endl;
+}
+
+/**
+ * @brief Slot the simulation may fill
+ */
+FrameSnapshot &RenderThread::beginFrame() {
+    FrameSnapshot &snapshot = slots[writeIndex];
+    snapshot.clear();
+    return snapshot;
+}
+
+/**
+ * @brief Swap the written slot with the latest one and flag it as new
+ */
+void RenderThread::publish() {
+    unsigned previous = latest.exchange(writeIndex | FRESH_FRAME, std::memory_order_acq_rel);
+    writeIndex = previous & ~FRESH_FRAME;
+}
+
+/**
+ * @brief Last mushroom change drawn into the layer
+ */
+MushroomAck RenderThread::getMushroomAck() const {
+    std::uint64_t packed = mushroomAck.load(std::memory_order_acquire);
+
+    MushroomAck ack;
+    ack.session = static_cast<std::uint32_t>(packed >> 48);
+    ack.sequence = packed & ((std::uint64_t(1) << 48) - 1);
+    return ack;
+}
+
+/**
+ * @brief Swap in the latest slot if the simulation published one
+ * @return true if readIndex now holds a frame not drawn before
+ */
+bool RenderThread::acquireLatest() {
+    if ((latest.load(std::memory_order_acquire) & FRESH_FRAME) == 0) {
+        return false;
+    }
+
+    unsigned previous = latest.exchange(readIndex, std::memory_order_acq_rel);
+    readIndex = previous & ~FRESH_FRAME;
+    return true;
+}
+
+/**
+ * @brief Render thread body
+ *
+ * Sleeps until the pacer's render latch, then draws the newest snapshot
+ * (redrawing the last one if nothing new arrived), displays it and waits
+ * for the GPU to finish, which is what the pacer's cost prediction measures.
+ */
+void RenderThread::renderLoop() {
+    window.setActive(true);
+
+    bool haveFrame = false;
+    while (running) {
+        pacer.waitToRender();
+
+        if (acquireLatest()) {
+            haveFrame = true;
+        }
+
+        if (!haveFrame) {
+            pacer.skipFrame();
+            continue;
+        }
+
+        window.clear(sf::Color::Black);
+        drawSnapshot(slots[readIndex]);
+        window.display();
+
+        // Cap the render-ahead: nothing stays queued behind this frame
+        glFinish();
+        pacer.framePresented(slots[readIndex].inputTime);
+    }
+
+    for (auto &entry : chunkLayers) {
+        if (entry.second.texture) {
+            entry.second.texture->setActive(false);
+        }
+    }
+    window.setActive(false);
+}
+
+/**
+ * @brief Create the texture of one chunk layer
+ *
+ * No depth buffer, no sRGB, no mipmaps: plain RGBA that Mesa's software
+ * rasteriser (llvmpipe) supports. On failure every chunk is drawn as
+ * ordinary sprites from then on.
+ */
+bool RenderThread::createChunkTexture(ChunkLayer &layer, float chunkPixels) {
+    unsigned size = static_cast<unsigned>(std::ceil(chunkPixels));
+    if (size == 0 || size > sf::Texture::getMaximumSize()) {
+        std::cerr << "[RenderThread] Chunk larger than max texture size, drawing mushrooms directly" << std::endl;
+        layersSupported = false;
+        return false;
+    }
+
+    std::unique_ptr<sf::RenderTexture> texture(new sf::RenderTexture());
+    if (!texture->create(size, size)) {
+        std::cerr << "[RenderThread] Could not create chunk layer, drawing mushrooms directly" << std::endl;
+        layersSupported = false;
+        return false;
+    }
+
+    // The layer is copied 1:1 onto the window, no filtering needed
+    texture->setSmooth(false);
+    layer.texture = std::move(texture);
+    return true;
+}
+
+/**
+ * @brief Create textures for chunks coming into view, free far ones
+ *
+ * A new texture gets a full redraw of its chunk. Chunks more than one
+ * chunk outside the view lose their texture but keep their mushrooms,
+ * so scrolling back only costs one redraw.
+ */
+void RenderThread::streamChunkLayers(const FrameSnapshot &snapshot) {
+    if (snapshot.chunkPixels <= 0.0f) {
+        return;
+    }
+
+    sf::FloatRect view = viewRect(snapshot.view);
+    float margin = snapshot.chunkPixels;
+    sf::FloatRect keep(view.left - margin, view.top - margin, view.width + 2 * margin, view.height + 2 * margin);
+
+    for (auto &entry : chunkLayers) {
+        ChunkLayer &layer = entry.second;
+        sf::FloatRect rect = snapshot.chunkRect(entry.first);
+
+        if (!rect.intersects(keep)) {
+            layer.texture.reset();
+            continue;
+        }
+
+        if (!layer.texture && layersSupported && !layer.mushrooms.empty() && rect.intersects(view)) {
+            if (createChunkTexture(layer, snapshot.chunkPixels)) {
+                redrawLayerRegion(layer, rect, rect, snapshot.atlas);
+                layer.texture->display();
+            }
+        }
+    }
+
+    if (!layersSupported) {
+        for (auto &entry : chunkLayers) {
+            entry.second.texture.reset();
+        }
+    }
+}
+
+/**
+ * @brief Bring the chunk layers up to date with the snapshot's mushroom changes
+ *
+ * Changes already applied (sequence <= layerSequence) are skipped, since
+ * the same changes keep arriving until the simulation sees the ack.
+ * Each change dirties the old and new rectangle of that mushroom, and
+ * only those rectangles are redrawn, in chunks that have a texture.
+ */
+void RenderThread::applyMushroomChanges(const FrameSnapshot &snapshot) {
+    std::vector<std::pair<std::uint32_t, sf::FloatRect>> dirtyRegions;
+
+    if (snapshot.mushroomSession != layerSession) {
+        // New game: start from an empty world
+        layerSession = snapshot.mushroomSession;
+        layerSequence = 0;
+        chunkLayers.clear();
+    }
+
+    for (const MushroomChange &change : snapshot.mushroomChanges) {
+        if (change.sequence <= layerSequence) {
+            continue;
+        }
+        layerSequence = change.sequence;
+
+        std::map<std::uint32_t, SpriteInstance> &mushrooms = chunkLayers[change.chunk].mushrooms;
+        auto existing = mushrooms.find(change.cell);
+        if (existing != mushrooms.end()) {
+            dirtyRegions.push_back(std::make_pair(change.chunk, existing->second.bounds()));
+        }
+
+        if (change.removed) {
+            if (existing != mushrooms.end()) {
+                mushrooms.erase(existing);
+            }
+        } else {
+            mushrooms[change.cell] = change.sprite;
+            dirtyRegions.push_back(std::make_pair(change.chunk, change.sprite.bounds()));
+        }
+    }
+
+    std::vector<ChunkLayer *> touched;
+    for (const auto &dirty : dirtyRegions) {
+        ChunkLayer &layer = chunkLayers[dirty.first];
+        if (!layer.texture) {
+            continue;
+        }
+        redrawLayerRegion(layer, snapshot.chunkRect(dirty.first), dirty.second, snapshot.atlas);
+        if (std::find(touched.begin(), touched.end(), &layer) == touched.end()) {
+            touched.push_back(&layer);
+        }
+    }
+    for (ChunkLayer *layer : touched) {
+        layer->texture->display();
+    }
+
+    mushroomAck.store((std::uint64_t(layerSession) << 48) | layerSequence, std::memory_order_release);
+}
+
+/**
+ * @brief Clear one rectangle of a chunk layer and redraw the mushrooms in it
+ *
+ * The layer's view maps world coordinates onto the chunk texture; a
+ * viewport matching the rectangle clips the drawing, so neighbours that
+ * stick out of the rectangle are not drawn twice.
+ */
+void RenderThread::redrawLayerRegion(ChunkLayer &layer, sf::FloatRect chunkRect, sf::FloatRect region, const sf::Texture *atlas) {
+    sf::RenderTexture &target = *layer.texture;
+    sf::Vector2f size(target.getSize());
+
+    // Snap to whole pixels and clamp to the chunk
+    float left = std::max(chunkRect.left, std::floor(region.left));
+    float top = std::max(chunkRect.top, std::floor(region.top));
+    float right = std::min(chunkRect.left + size.x, std::ceil(region.left + region.width));
+    float bottom = std::min(chunkRect.top + size.y, std::ceil(region.top + region.height));
+    if (right <= left || bottom <= top) {
+        return;
+    }
+    sf::FloatRect clip(left, top, right - left, bottom - top);
+
+    sf::View view(clip);
+    view.setViewport(sf::FloatRect((clip.left - chunkRect.left) / size.x, (clip.top - chunkRect.top) / size.y,
+                                   clip.width / size.x, clip.height / size.y));
+    target.setView(view);
+
+    // Punch a transparent hole (BlendNone writes alpha 0 instead of blending)
+    sf::RectangleShape hole(sf::Vector2f(clip.width, clip.height));
+    hole.setPosition(clip.left, clip.top);
+    hole.setFillColor(sf::Color::Transparent);
+    target.draw(hole, sf::RenderStates(sf::BlendNone));
+
+    layerBatch.clear();
+    for (const auto &entry : layer.mushrooms) {
+        if (entry.second.bounds().intersects(clip)) {
+            appendSprite(layerBatch, entry.second);
+        }
+    }
+
+    sf::RenderStates states;
+    states.texture = atlas;
+    target.draw(layerBatch, states);
+
+    target.setView(target.getDefaultView());
+}
+
+/**
+ * @brief World rectangle a view shows
+ */
+sf::FloatRect RenderThread::viewRect(const sf::View &view) {
+    sf::Vector2f size = view.getSize();
+    sf::Vector2f center = view.getCenter();
+    return sf::FloatRect(center.x - size.x / 2, center.y - size.y / 2, size.x, size.y);
+}
+
+/**
+ * @brief Draw the visible chunk layers, all other sprites in one batch,
+ * the particles in a second one, then the HUD
+ */
+void RenderThread::drawSnapshot(const FrameSnapshot &snapshot) {
+    applyMushroomChanges(snapshot);
+    streamChunkLayers(snapshot);
+
+    window.setView(snapshot.view);
+    sf::FloatRect view = viewRect(snapshot.view);
+
+    batch.clear();
+    for (const auto &entry : chunkLayers) {
+        sf::FloatRect rect = snapshot.chunkRect(entry.first);
+        if (!rect.intersects(view)) {
+            continue;
+        }
+
+        if (entry.second.texture) {
+            sf::Sprite layer(entry.second.texture->getTexture());
+            layer.setPosition(rect.left, rect.top);
+            window.draw(layer);
+        } else {
+            for (const auto &mushroom : entry.second.mushrooms) {
+                appendSprite(batch, mushroom.second);
+            }
+        }
+    }
+
+    for (const SpriteInstance &instance : snapshot.sprites) {
+        appendSprite(batch, instance);
+    }
+
+    sf::RenderStates states;
+    states.texture = snapshot.atlas;
+    window.draw(batch, states);
+
+    if (!snapshot.particles.empty()) {
+        writeParticles(particleBatch, snapshot.particles);
+        window.draw(particleBatch);
+    }
+    window.setView(window.getDefaultView());
+
+    // Only rebuild HUD strings when the numbers change
+    if (snapshot.score != shownScore) {
+        shownScore = snapshot.score;
+        scoreText.setString("Score: " + std::to_string(shownScore));
+    }
+    if (snapshot.lives != shownLives) {
+        shownLives = snapshot.lives;
+        livesText.setString("Lives: " + std::to_string(shownLives));
+    }
+    if (snapshot.level != shownLevel) {
+        shownLevel = snapshot.level;
+        levelText.setString("Level: " + std::to_string(shownLevel));
+    }
+
+    window.draw(scoreText);
+    window.draw(livesText);
+    window.draw(levelText);
+}
+
+/**
+ * @brief Append the two triangles of one sprite to a vertex array
+ */
+void RenderThread::appendSprite(sf::VertexArray &vertices, const SpriteInstance &instance) {
+    const sf::IntRect &rect = instance.textureRect;
+
+    float left = instance.position.x - instance.origin.x * instance.scale.x;
+    float top = instance.position.y - instance.origin.y * instance.scale.y;
+    float right = left + rect.width * instance.scale.x;
+    float bottom = top + rect.height * instance.scale.y;
+
+    float u1 = static_cast<float>(rect.left);
+    float v1 = static_cast<float>(rect.top);
+    float u2 = u1 + rect.width;
+    float v2 = v1 + rect.height;
+
+    vertices.append(sf::Vertex(sf::Vector2f(left, top), sf::Vector2f(u1, v1)));
+    vertices.append(sf::Vertex(sf::Vector2f(right, top), sf::Vector2f(u2, v1)));
+    vertices.append(sf::Vertex(sf::Vector2f(left, bottom), sf::Vector2f(u1, v2)));
+    vertices.append(sf::Vertex(sf::Vector2f(left, bottom), sf::Vector2f(u1, v2)));
+    vertices.append(sf::Vertex(sf::Vector2f(right, top), sf::Vector2f(u2, v1)));
+    vertices.append(sf::Vertex(sf::Vector2f(right, bottom), sf::Vector2f(u2, v2)));
+}
+
+/**
+ * @brief Fill a vertex array with one coloured square (two triangles) per particle
+ *          Sized once and written in place, so 100k particles cost no appends
+ */
+void RenderThread::writeParticles(sf::VertexArray &vertices, const std::vector<ParticleInstance> &particles) {
+    vertices.resize(particles.size() * 6);
+
+    for (std::size_t i = 0; i < particles.size(); i++) {
+        const ParticleInstance &particle = particles[i];
+        float half = particle.size / 2;
+        float left = particle.position.x - half;
+        float top = particle.position.y - half;
+        float right = particle.position.x + half;
+        float bottom = particle.position.y + half;
+
+        sf::Vertex *quad = &vertices[i * 6];
+        quad[0] = sf::Vertex(sf::Vector2f(left, top), particle.color);
+        quad[1] = sf::Vertex(sf::Vector2f(right, top), particle.color);
+        quad[2] = sf::Vertex(sf::Vector2f(left, bottom), particle.color);
+        quad[3] = sf::Vertex(sf::Vector2f(left, bottom), particle.color);
+        quad[4] = sf::Vertex(sf::Vector2f(right, top), particle.color);
+        quad[5] = sf::Vertex(sf::Vector2f(right, bottom), particle.color);
+    }
+}
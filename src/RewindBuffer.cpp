@@ -0,0 +1,238 @@
+/**
+ * @file RewindBuffer.cpp
+ * @author Ian Codding II
+ * @brief Keyframe + XOR-delta ring of save states
+ * @version 1.0
+ * @date 2025-12-19
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include "../includes/RewindBuffer.h"
+#include "../includes/FrameLimiter.h"
+#include "../includes/SaveState.h"
+#include <algorithm>
+#include <iostream>
+
+/**
+ * @brief Empty history with a byte budget
+ */
+RewindBuffer::RewindBuffer(std::size_t budgetBytes)
+    : budget(budgetBytes),
+      totalBytes(0),
+      sinceKeyframe(0),
+      captureStride(1),
+      tickCounter(0),
+      costTotal(0),
+      costMax(0),
+      costSamples(0) {
+}
+
+/**
+ * @brief Every captureStride-th tick is captured
+ */
+bool RewindBuffer::wantsCapture() {
+    if (++tickCounter < captureStride) {
+        return false;
+    }
+    tickCounter = 0;
+    return true;
+}
+
+/**
+ * @brief Store a keyframe or a delta against the previous capture
+ */
+void RewindBuffer::capture(const std::vector<std::uint8_t> &state, std::uint64_t encodeMicros) {
+    std::uint64_t start = FrameLimiter::nowMicros();
+
+    Entry entry;
+    entry.data = takeBuffer();
+    entry.stride = captureStride;
+    if (entries.empty() || sinceKeyframe + 1 >= KEYFRAME_INTERVAL) {
+        entry.keyframe = true;
+        entry.data.assign(state.begin(), state.end());
+        sinceKeyframe = 0;
+    } else {
+        encodeDelta(latest, state, entry.data);
+        sinceKeyframe++;
+    }
+
+    totalBytes += entry.data.size();
+    entries.push_back(std::move(entry));
+    latest.assign(state.begin(), state.end());
+    evict();
+
+    // Keep the average cost per tick under the budget
+    std::uint64_t cost = encodeMicros + (FrameLimiter::nowMicros() - start);
+    costTotal += cost;
+    costMax = std::max(costMax, cost);
+    costSamples++;
+    if (cost > CAPTURE_BUDGET_US && captureStride < MAX_STRIDE) {
+        captureStride *= 2;
+    } else if (cost * captureStride < CAPTURE_BUDGET_US / 2 && captureStride > 1) {
+        captureStride /= 2;
+    }
+}
+
+/**
+ * @brief Drop the newest capture, rebuild the one before from its keyframe
+ */
+bool RewindBuffer::stepBack(std::vector<std::uint8_t> &state) {
+    if (entries.size() < 2) {
+        return false;
+    }
+
+    totalBytes -= entries.back().data.size();
+    recycle(entries.back());
+    entries.pop_back();
+
+    // Newest keyframe at or before the new last entry
+    std::size_t key = entries.size() - 1;
+    while (!entries[key].keyframe) {
+        key--;
+    }
+
+    latest.assign(entries[key].data.begin(), entries[key].data.end());
+    for (std::size_t i = key + 1; i < entries.size(); i++) {
+        applyDelta(entries[i].data, latest);
+    }
+    sinceKeyframe = entries.size() - 1 - key;
+    tickCounter = 0;
+
+    state = latest;
+    return true;
+}
+
+/**
+ * @brief Forget all history (keeps the buffers for reuse)
+ */
+void RewindBuffer::clear() {
+    for (Entry &entry : entries) {
+        recycle(entry);
+    }
+    entries.clear();
+    latest.clear();
+    totalBytes = 0;
+    sinceKeyframe = 0;
+    tickCounter = 0;
+}
+
+/**
+ * @brief Log how much history the budget holds and what capturing costs
+ */
+void RewindBuffer::report(double tickRate) {
+    std::uint64_t ticks = 0;
+    std::size_t keyframes = 0;
+    for (const Entry &entry : entries) {
+        ticks += entry.stride;
+        keyframes += entry.keyframe ? 1 : 0;
+    }
+    double seconds = ticks / tickRate;
+
+    std::cout << "[RewindBuffer] " << seconds << " s of history in " << totalBytes / 1024 << " KB";
+    if (seconds > 0) {
+        std::cout << " (" << totalBytes / 1024.0 / seconds << " KB/s)";
+    }
+    std::cout << " | " << entries.size() << " captures, " << keyframes << " keyframes | capture avg "
+              << (costSamples ? costTotal / costSamples : 0) << " us, max " << costMax
+              << " us | every " << captureStride << " tick(s)" << std::endl;
+
+    costTotal = costMax = costSamples = 0;
+}
+
+/**
+ * @brief Drop the oldest keyframe groups while over budget
+ *          The group holding the newest capture always stays
+ */
+void RewindBuffer::evict() {
+    while (totalBytes > budget) {
+        std::size_t groupEnd = 1;
+        while (groupEnd < entries.size() && !entries[groupEnd].keyframe) {
+            groupEnd++;
+        }
+        if (groupEnd >= entries.size()) {
+            return;
+        }
+
+        for (std::size_t i = 0; i < groupEnd; i++) {
+            totalBytes -= entries.front().data.size();
+            recycle(entries.front());
+            entries.pop_front();
+        }
+    }
+}
+
+/**
+ * @brief An empty buffer, reusing one from a dropped entry when possible
+ */
+std::vector<std::uint8_t> RewindBuffer::takeBuffer() {
+    if (spare.empty()) {
+        return std::vector<std::uint8_t>();
+    }
+    std::vector<std::uint8_t> buffer = std::move(spare.back());
+    spare.pop_back();
+    buffer.clear();
+    return buffer;
+}
+
+void RewindBuffer::recycle(Entry &entry) {
+    spare.push_back(std::move(entry.data));
+}
+
+/**
+ * @brief Delta format: new size, then (zero run, literal count, literal bytes)
+ *          pairs of next XOR base (base is read as zeros past its end)
+ */
+void RewindBuffer::encodeDelta(const std::vector<std::uint8_t> &base, const std::vector<std::uint8_t> &next,
+                               std::vector<std::uint8_t> &out) {
+    SaveWriter writer(out);
+    writer.writeVarint(next.size());
+
+    auto diff = [&](std::size_t i) -> std::uint8_t {
+        return next[i] ^ (i < base.size() ? base[i] : 0);
+    };
+
+    std::size_t i = 0;
+    while (i < next.size()) {
+        std::size_t zeros = 0;
+        while (i + zeros < next.size() && diff(i + zeros) == 0) {
+            zeros++;
+        }
+        i += zeros;
+
+        // Literal run until three unchanged bytes in a row (cheaper to skip) or the end
+        std::size_t literal = 0;
+        while (i + literal < next.size()) {
+            if (diff(i + literal) == 0 && i + literal + 2 < next.size() &&
+                diff(i + literal + 1) == 0 && diff(i + literal + 2) == 0) {
+                break;
+            }
+            literal++;
+        }
+
+        writer.writeVarint(zeros);
+        writer.writeVarint(literal);
+        for (std::size_t k = 0; k < literal; k++) {
+            writer.writeByte(diff(i + k));
+        }
+        i += literal;
+    }
+}
+
+/**
+ * @brief Turn the previous state into the next one
+ */
+void RewindBuffer::applyDelta(const std::vector<std::uint8_t> &delta, std::vector<std::uint8_t> &state) {
+    SaveReader reader(delta.data(), delta.size());
+    std::size_t size = static_cast<std::size_t>(reader.readVarint());
+    state.resize(size, 0);
+
+    std::size_t i = 0;
+    while (reader.remaining() > 0 && reader.ok()) {
+        i += static_cast<std::size_t>(reader.readVarint());
+        std::size_t literal = static_cast<std::size_t>(reader.readVarint());
+        for (std::size_t k = 0; k < literal && i < size; k++, i++) {
+            state[i] ^= reader.readByte();
+        }
+    }
+}
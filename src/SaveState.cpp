@@ -0,0 +1,214 @@
+/**
+ * @file SaveState.cpp
+ * @author Ian Codding II
+ * @brief Varint, float-delta and bit-packed encoding for save states
+ * @version 1.0
+ * @date 2025-12-18
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include "../includes/SaveState.h"
+#include <cstring>
+
+namespace {
+
+std::uint32_t floatBits(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bitsFloat(std::uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+// ===== WRITER =====
+
+/**
+ * @brief Writer appending to out
+ */
+SaveWriter::SaveWriter(std::vector<std::uint8_t> &out)
+    : out(out),
+      bitBuffer(0),
+      bitCount(0) {
+}
+
+void SaveWriter::writeByte(std::uint8_t value) {
+    out.push_back(value);
+}
+
+/**
+ * @brief Fixed four bytes, little endian
+ */
+void SaveWriter::writeU32(std::uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+}
+
+/**
+ * @brief Seven bits per byte, high bit set on all but the last
+ */
+void SaveWriter::writeVarint(std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+/**
+ * @brief Zigzag (0, -1, 1, -2 ... -> 0, 1, 2, 3 ...), then varint
+ */
+void SaveWriter::writeSigned(std::int64_t value) {
+    writeVarint((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+}
+
+/**
+ * @brief Raw IEEE bits, for values with no useful neighbour to delta against
+ */
+void SaveWriter::writeFloat(float value) {
+    writeU32(floatBits(value));
+}
+
+void SaveWriter::writeFloatDelta(float value, float previous) {
+    writeSigned(static_cast<std::int64_t>(floatBits(value)) - static_cast<std::int64_t>(floatBits(previous)));
+}
+
+void SaveWriter::writeDelta(sf::Vector2f value, sf::Vector2f &previous) {
+    writeFloatDelta(value.x, previous.x);
+    writeFloatDelta(value.y, previous.y);
+    previous = value;
+}
+
+/**
+ * @brief Append the low count bits of value (count <= 24), least significant first
+ */
+void SaveWriter::writeBits(std::uint32_t value, unsigned count) {
+    bitBuffer |= (value & ((1u << count) - 1)) << bitCount;
+    bitCount += count;
+    while (bitCount >= 8) {
+        out.push_back(static_cast<std::uint8_t>(bitBuffer));
+        bitBuffer >>= 8;
+        bitCount -= 8;
+    }
+}
+
+/**
+ * @brief Pad the bit stream to a whole byte
+ */
+void SaveWriter::flushBits() {
+    if (bitCount > 0) {
+        out.push_back(static_cast<std::uint8_t>(bitBuffer));
+    }
+    bitBuffer = 0;
+    bitCount = 0;
+}
+
+// ===== READER =====
+
+/**
+ * @brief Reader over size bytes at data (not copied)
+ */
+SaveReader::SaveReader(const std::uint8_t *data, std::size_t size)
+    : data(data),
+      size(size),
+      position(0),
+      bitBuffer(0),
+      bitCount(0),
+      failed(false) {
+}
+
+std::uint8_t SaveReader::readByte() {
+    if (position >= size) {
+        failed = true;
+        return 0;
+    }
+    return data[position++];
+}
+
+std::uint32_t SaveReader::readU32() {
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; i++) {
+        value |= static_cast<std::uint32_t>(readByte()) << (8 * i);
+    }
+    return value;
+}
+
+std::uint64_t SaveReader::readVarint() {
+    std::uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        std::uint8_t byte = readByte();
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    failed = true;   // Longer than any 64-bit value
+    return 0;
+}
+
+std::int64_t SaveReader::readSigned() {
+    std::uint64_t value = readVarint();
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+float SaveReader::readFloat() {
+    return bitsFloat(readU32());
+}
+
+float SaveReader::readFloatDelta(float previous) {
+    return bitsFloat(static_cast<std::uint32_t>(floatBits(previous) + readSigned()));
+}
+
+sf::Vector2f SaveReader::readDelta(sf::Vector2f &previous) {
+    previous.x = readFloatDelta(previous.x);
+    previous.y = readFloatDelta(previous.y);
+    return previous;
+}
+
+/**
+ * @brief Next count bits of the bit stream (count <= 24)
+ */
+std::uint32_t SaveReader::readBits(unsigned count) {
+    while (bitCount < count) {
+        bitBuffer |= static_cast<std::uint32_t>(readByte()) << bitCount;
+        bitCount += 8;
+    }
+    std::uint32_t value = bitBuffer & ((1u << count) - 1);
+    bitBuffer >>= count;
+    bitCount -= count;
+    return value;
+}
+
+/**
+ * @brief Drop the padding after a bit stream
+ */
+void SaveReader::alignBits() {
+    bitBuffer = 0;
+    bitCount = 0;
+}
+
+std::size_t SaveReader::readCount(std::size_t limit) {
+    std::uint64_t count = readVarint();
+    if (count > limit) {
+        failed = true;
+        return 0;
+    }
+    return static_cast<std::size_t>(count);
+}
+
+// ===== HASH =====
+
+std::uint32_t saveHash(const std::uint8_t *data, std::size_t size) {
+    std::uint32_t hash = 2166136261u;
+    for (std::size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
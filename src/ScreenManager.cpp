@@ -148,6 +148,12 @@ void ScreenManager::update(sf::Event &event) {
     // This processes the event and returns the next state to go to
     GameState nextState = currentScreen->update(event);
 
+    // Screens mark themselves dirty when input changes what they show
+    // (flushInput() covers buttons); only window events force a redraw
+    if (event.type == sf::Event::Resized || event.type == sf::Event::GainedFocus) {
+        currentScreen->markDirty();
+    }
+
     // Check if the state changed
     if (nextState != currentState) {
         std::cout << "[ScreenManager] State transition detected: "
@@ -159,6 +165,17 @@ void ScreenManager::update(sf::Event &event) {
     }
 }
 
+/**
+ * @brief Finish the frame's input on the current screen
+ *
+ * Called once per frame after all events went through update().
+ */
+void ScreenManager::flushInput() {
+    if (currentScreen != nullptr) {
+        currentScreen->flushInput();
+    }
+}
+
 /**
  * @brief Render - draw the current screen
  *
@@ -175,6 +192,16 @@ void ScreenManager::render() {
 
     // Forward the render call to the current screen
     currentScreen->render();
+    currentScreen->markClean();
+}
+
+/**
+ * @brief Whether the current screen changed since it was last drawn
+ *
+ * With no screen there is nothing to draw, so nothing is ever "dirty".
+ */
+bool ScreenManager::needsRedraw() const {
+    return currentScreen != nullptr && currentScreen->isDirty();
 }
 
 /**
@@ -221,6 +248,7 @@ void ScreenManager::setState(GameState newState) {
     // If screen is valid, initialize it
     if (currentScreen != nullptr) {
         currentScreen->initialize();
+        currentScreen->markDirty();
         std::cout << "[ScreenManager] New screen initialized" << std::endl;
     } else {
         logError("ScreenManager", "Failed to get screen for state");
@@ -129,60 +129,70 @@ void SettingsScreen::initialize() {
     );
     backButton->setColorTextNormal(sf::Color::Black);
     backButton->setColorTextHover(sf::Color::Yellow);
+
+    // Cache the button rectangles for hit-testing
+    buttons.clear();
+    buttons.add(livesDownButton);
+    buttons.add(livesUpButton);
+    buttons.add(levelDownButton);
+    buttons.add(levelUpButton);
+    buttons.add(backButton);
 }
 
 /**
  * @brief Update the settings
  */
 GameState SettingsScreen::update(sf::Event& event) {
+    Button* pressed = buttons.handleEvent(event, window);
+    if (pressed == nullptr) {
+        return GameState::SETTINGS;
+    }
+
     // Lives Down
-    if (livesDownButton) {
-        livesDownButton->update(event, window);
-        if (livesDownButton->getState() == clicked && lives > 1) {
-            lives--;
-            std::cout << "[SettingsScreen] Lives decreased to " << lives << std::endl;
-        }
+    if (pressed == livesDownButton && lives > 1) {
+        lives--;
+        std::cout << "[SettingsScreen] Lives decreased to " << lives << std::endl;
     }
 
     // Lives Up
-    if (livesUpButton) {
-        livesUpButton->update(event, window);
-        if (livesUpButton->getState() == clicked && lives < 50) {
-            lives++;
-            std::cout << "[SettingsScreen] Lives increased to " << lives << std::endl;
-        }
+    if (pressed == livesUpButton && lives < 50) {
+        lives++;
+        std::cout << "[SettingsScreen] Lives increased to " << lives << std::endl;
     }
 
     // Spawn Level Down
-    if (levelDownButton) {
-        levelDownButton->update(event, window);
-        if (levelDownButton->getState() == clicked && spawnLevel > 0) {
-            spawnLevel--;
-            std::cout << "[SettingsScreen] Spawn level decreased to " << spawnLevel << std::endl;
-        }
+    if (pressed == levelDownButton && spawnLevel > 0) {
+        spawnLevel--;
+        std::cout << "[SettingsScreen] Spawn level decreased to " << spawnLevel << std::endl;
     }
 
     // Spawn Level Up
-    if (levelUpButton) {
-        levelUpButton->update(event, window);
-        if (levelUpButton->getState() == clicked) {
-            spawnLevel++;
-            std::cout << "[SettingsScreen] Spawn level increased to " << spawnLevel << std::endl;
-        }
+    if (pressed == levelUpButton) {
+        spawnLevel++;
+        std::cout << "[SettingsScreen] Spawn level increased to " << spawnLevel << std::endl;
     }
 
+    // The values on screen may have changed
+    markDirty();
+
     // Back button
-    if (backButton) {
-        backButton->update(event, window);
-        if (backButton->getState() == clicked) {
-            std::cout << "[SettingsScreen] Back clicked" << std::endl;
-            return GameState::MENU;
-        }
+    if (pressed == backButton) {
+        std::cout << "[SettingsScreen] Back clicked" << std::endl;
+        return GameState::MENU;
     }
 
     return GameState::SETTINGS;
 }
 
+/**
+ * @brief Hit-test the mouse once per frame
+ */
+void SettingsScreen::flushInput() {
+    if (buttons.flush(window)) {
+        markDirty();
+    }
+}
+
 /**
  * @brief Render the menu
  */
@@ -218,6 +228,7 @@ void SettingsScreen::render() {
 void SettingsScreen::cleanup() {
     std::cout << "[SettingsScreen] cleanup() called" << std::endl;
 
+    buttons.clear();
     delete livesDownButton; livesDownButton = nullptr;
     delete livesUpButton; livesUpButton = nullptr;
     delete levelDownButton; levelDownButton = nullptr;
@@ -0,0 +1,150 @@
+/**
+ * @file StateChecksum.cpp
+ * @author Ian Codding II
+ * @brief Entity and tick hashing, and the checksum log
+ * @version 1.0
+ * @date 2025-12-20
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include "../includes/StateChecksum.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+const std::uint64_t HASH_SEED = 0xCBF29CE484222325ull;    // FNV-1a 64 offset basis
+const std::uint64_t HASH_PRIME = 0x100000001B3ull;
+
+/**
+ * @brief One FNV-style step per 64-bit word instead of per byte, with a
+ *          shift so high bits reach the low ones
+ */
+inline std::uint64_t mix(std::uint64_t hash, std::uint64_t value) {
+    hash = (hash ^ value) * HASH_PRIME;
+    return hash ^ (hash >> 32);
+}
+
+} // namespace
+
+StateChecksum::StateChecksum()
+    : tick(0),
+      dt(0),
+      held(0),
+      pressed(0),
+      tickHash(HASH_SEED),
+      entityHash(HASH_SEED),
+      inEntity(false) {
+}
+
+bool StateChecksum::openLog(const std::string &path) {
+    log.open(path, std::ios::trunc);
+    return log.good();
+}
+
+/**
+ * @brief Start a tick (the tick inputs are logged, not hashed)
+ */
+void StateChecksum::beginTick(std::uint64_t tickNumber, float tickDt, std::uint16_t heldButtons,
+                              std::uint16_t pressedButtons) {
+    tick = tickNumber;
+    dt = tickDt;
+    held = heldButtons;
+    pressed = pressedButtons;
+    tickHash = HASH_SEED;
+    inEntity = false;
+    entities.clear();
+}
+
+void StateChecksum::beginEntity(const char *kind, int index, int part) {
+    finishEntity();
+    entityHash = HASH_SEED;
+    inEntity = true;
+    if (log.is_open()) {
+        entities.push_back(EntityHash{kind, index, part, 0});
+    }
+}
+
+void StateChecksum::add(std::uint64_t value) {
+    entityHash = mix(entityHash, value);
+}
+
+/**
+ * @brief Bit pattern, so -0.0 and 0.0 (or two NaNs) still differ
+ */
+void StateChecksum::addFloat(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    add(bits);
+}
+
+void StateChecksum::addVector(sf::Vector2f value) {
+    std::uint32_t bits[2];
+    std::memcpy(&bits[0], &value.x, sizeof(bits[0]));
+    std::memcpy(&bits[1], &value.y, sizeof(bits[1]));
+    add(static_cast<std::uint64_t>(bits[0]) | static_cast<std::uint64_t>(bits[1]) << 32);
+}
+
+/**
+ * @brief Eight bytes per step, then the tail and the length
+ */
+void StateChecksum::addBytes(const std::uint8_t *data, std::size_t size) {
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        add(word);
+    }
+    std::uint64_t tail = 0;
+    for (std::size_t k = 0; i + k < size; k++) {
+        tail |= static_cast<std::uint64_t>(data[i + k]) << (8 * k);
+    }
+    add(tail);
+    add(size);
+}
+
+std::uint64_t StateChecksum::endTick() {
+    finishEntity();
+    if (log.is_open()) {
+        writeLog();
+    }
+    return tickHash;
+}
+
+/**
+ * @brief Fold the current entity's hash into the tick hash
+ */
+void StateChecksum::finishEntity() {
+    if (!inEntity) {
+        return;
+    }
+    tickHash = mix(tickHash, entityHash);
+    if (log.is_open()) {
+        entities.back().hash = entityHash;
+    }
+    inEntity = false;
+}
+
+/**
+ * @brief One header line for the tick, one indented line per entity
+ */
+void StateChecksum::writeLog() {
+    char line[128];
+    std::snprintf(line, sizeof(line), "tick %llu dt %.9g input %u/%u hash %016llx\n",
+                  static_cast<unsigned long long>(tick), static_cast<double>(dt),
+                  static_cast<unsigned>(held), static_cast<unsigned>(pressed),
+                  static_cast<unsigned long long>(tickHash));
+    log << line;
+
+    for (const EntityHash &entity : entities) {
+        if (entity.part >= 0) {
+            std::snprintf(line, sizeof(line), "  %s %d.%d %016llx\n", entity.kind, entity.index, entity.part,
+                          static_cast<unsigned long long>(entity.hash));
+        } else {
+            std::snprintf(line, sizeof(line), "  %s %d %016llx\n", entity.kind, entity.index,
+                          static_cast<unsigned long long>(entity.hash));
+        }
+        log << line;
+    }
+}
@@ -0,0 +1,662 @@
+/**
+ * @file    World.cpp
+ * @author  Balin Becker
+ * @brief   Chunked playfield definitions
+ * @date    2025-12-11
+ */
+
+#include "../includes/World.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Split the grid into chunks, all active and empty
+ * 
+ * @param grid Grid covering the whole playfield
+ */
+World::World(const Grid& grid)
+    : mFlow(grid.GetColumns(), grid.GetRows()) {
+    mOrigin = sf::Vector2f(grid.GetRegion().left, grid.GetRegion().top);
+    mCellSize = static_cast<float>(grid.GetCellSize());
+    mColumns = grid.GetColumns();
+    mRows = grid.GetRows();
+    mChunkColumns = (mColumns + CHUNK_CELLS - 1) / CHUNK_CELLS;
+    mChunkRows = (mRows + CHUNK_CELLS - 1) / CHUNK_CELLS;
+
+    mChunks.resize(static_cast<std::size_t>(mChunkColumns) * mChunkRows);
+    for (int chunk = 0; chunk < getChunkCount(); chunk++) {
+        mChunks[chunk].tiles = makeField(chunk);
+    }
+}
+
+// ===== ADDRESSING =====
+
+/**
+ * @brief Origin and size in cells of one chunk's field (edge chunks may be smaller)
+ */
+void World::fieldShape(int chunk, sf::Vector2f& origin, int& columns, int& rows) const {
+    int cx = chunk % mChunkColumns;
+    int cy = chunk / mChunkColumns;
+    columns = std::min(CHUNK_CELLS, mColumns - cx * CHUNK_CELLS);
+    rows = std::min(CHUNK_CELLS, mRows - cy * CHUNK_CELLS);
+    origin = sf::Vector2f(mOrigin.x + cx * CHUNK_CELLS * mCellSize, mOrigin.y + cy * CHUNK_CELLS * mCellSize);
+}
+
+/**
+ * @brief Empty field covering one chunk
+ */
+std::unique_ptr<MushroomField> World::makeField(int chunk) const {
+    sf::Vector2f origin;
+    int columns, rows;
+    fieldShape(chunk, origin, columns, rows);
+    return std::unique_ptr<MushroomField>(new MushroomField(origin, mCellSize, columns, rows));
+}
+
+/**
+ * @brief Chunk holding a world cell
+ */
+int World::chunkOfCell(int cell) const {
+    int column = cell % mColumns;
+    int row = cell / mColumns;
+    return (row / CHUNK_CELLS) * mChunkColumns + column / CHUNK_CELLS;
+}
+
+/**
+ * @brief World cell -> cell index inside its chunk's field
+ */
+int World::localCell(int cell, int chunk) const {
+    int chunkColumns = std::min(CHUNK_CELLS, mColumns - (chunk % mChunkColumns) * CHUNK_CELLS);
+    int column = cell % mColumns - (chunk % mChunkColumns) * CHUNK_CELLS;
+    int row = cell / mColumns - (chunk / mChunkColumns) * CHUNK_CELLS;
+    return row * chunkColumns + column;
+}
+
+/**
+ * @brief Cell index inside a chunk's field -> world cell
+ */
+int World::globalCell(int chunk, int local) const {
+    int chunkColumns = std::min(CHUNK_CELLS, mColumns - (chunk % mChunkColumns) * CHUNK_CELLS);
+    int column = (chunk % mChunkColumns) * CHUNK_CELLS + local % chunkColumns;
+    int row = (chunk / mChunkColumns) * CHUNK_CELLS + local / chunkColumns;
+    return cellIndex(column, row);
+}
+
+/**
+ * @brief Chunk under a world position
+ * @return Chunk index, or -1 outside the playfield
+ */
+int World::chunkAt(sf::Vector2f position) const {
+    float chunkPixels = getChunkPixels();
+    int cx = static_cast<int>(std::floor((position.x - mOrigin.x) / chunkPixels));
+    int cy = static_cast<int>(std::floor((position.y - mOrigin.y) / chunkPixels));
+    if (cx < 0 || cy < 0 || cx >= mChunkColumns || cy >= mChunkRows) {
+        return -1;
+    }
+    return cy * mChunkColumns + cx;
+}
+
+/**
+ * @brief World rectangle of a chunk (full CHUNK_CELLS size, even at the edges)
+ */
+sf::FloatRect World::getChunkRect(int chunk) const {
+    float chunkPixels = getChunkPixels();
+    return sf::FloatRect(mOrigin.x + (chunk % mChunkColumns) * chunkPixels,
+                         mOrigin.y + (chunk / mChunkColumns) * chunkPixels,
+                         chunkPixels, chunkPixels);
+}
+
+/**
+ * @brief Whether the chunk under a position is simulated
+ */
+bool World::isActiveAt(sf::Vector2f position) const {
+    int chunk = chunkAt(position);
+    return chunk >= 0 && isActive(chunk);
+}
+
+/**
+ * @brief Chunks a rectangle overlaps, clamped to the playfield
+ * @return false if it misses the playfield
+ */
+bool World::chunkRange(const sf::FloatRect& bounds, int& cx1, int& cy1, int& cx2, int& cy2) const {
+    float chunkPixels = getChunkPixels();
+    cx1 = std::max(0, static_cast<int>(std::floor((bounds.left - mOrigin.x) / chunkPixels)));
+    cy1 = std::max(0, static_cast<int>(std::floor((bounds.top - mOrigin.y) / chunkPixels)));
+    cx2 = std::min(mChunkColumns - 1, static_cast<int>(std::floor((bounds.left + bounds.width - mOrigin.x) / chunkPixels)));
+    cy2 = std::min(mChunkRows - 1, static_cast<int>(std::floor((bounds.top + bounds.height - mOrigin.y) / chunkPixels)));
+    return cx1 <= cx2 && cy1 <= cy2;
+}
+
+// ===== STREAMING =====
+
+/**
+ * @brief Tile byte of one cell of a chunk
+ *          A packed chunk's runs are read in place, so this never
+ *          modifies the world and is safe from jobs
+ */
+std::uint8_t World::tileAt(int chunk, int local) const {
+    const Chunk& c = mChunks[chunk];
+    return c.tiles ? c.tiles->tile(local) : MushroomField::packedTile(c.packed, local);
+}
+
+/**
+ * @brief Mushroom of a packed chunk that a rectangle overlaps, read from
+ *          its runs without decoding them. Same cells and overlap rule
+ *          as MushroomField::firstHit / anyInRect
+ * @param lowest Find the lowest row's leftmost one (firstHit) instead
+ *          of stopping at the first one (anyInRect)
+ * @return Local cell, or -1 if none
+ */
+int World::packedHit(int chunk, const sf::FloatRect& bounds, bool lowest) const {
+    sf::Vector2f origin;
+    int columns, rows;
+    fieldShape(chunk, origin, columns, rows);
+
+    int col1 = std::max(0, static_cast<int>(std::floor((bounds.left - origin.x) / mCellSize)));
+    int row1 = std::max(0, static_cast<int>(std::floor((bounds.top - origin.y) / mCellSize)));
+    int col2 = std::min(columns - 1, static_cast<int>(std::ceil((bounds.left + bounds.width - origin.x) / mCellSize)) - 1);
+    int row2 = std::min(rows - 1, static_cast<int>(std::ceil((bounds.top + bounds.height - origin.y) / mCellSize)) - 1);
+    if (col1 > col2 || row1 > row2) {
+        return -1;
+    }
+
+    // Runs go in cell order, so a later hit is never in a higher row
+    const std::vector<std::uint8_t>& packed = mChunks[chunk].packed;
+    int best = -1;
+    int start = 0;
+    for (std::size_t i = 0; i + 1 < packed.size() && start <= row2 * columns + col2; i += 2) {
+        int end = start + packed[i];    // One past the run's last cell
+        if (packed[i + 1] != 0) {
+            int first = std::max(row1, start / columns);
+            int last = std::min(row2, (end - 1) / columns);
+            for (int row = first; row <= last; row++) {
+                int from = std::max(col1, row == start / columns ? start % columns : 0);
+                int to = std::min(col2, row == (end - 1) / columns ? (end - 1) % columns : columns - 1);
+                if (from > to) {
+                    continue;
+                }
+                if (!lowest) {
+                    return row * columns + from;
+                }
+                if (best < 0 || row > best / columns) {
+                    best = row * columns + from;
+                }
+            }
+        }
+        start = end;
+    }
+    return best;
+}
+
+/**
+ * @brief Unpack a chunk's tiles (main thread only)
+ */
+MushroomField& World::activate(int chunk) {
+    Chunk& c = mChunks[chunk];
+    if (!c.tiles) {
+        c.tiles = makeField(chunk);
+        c.tiles->unpack(c.packed);
+        std::vector<std::uint8_t>().swap(c.packed);
+        c.packedCount = 0;
+    }
+    return *c.tiles;
+}
+
+/**
+ * @brief Pack a chunk's tiles and free them (main thread only)
+ */
+void World::deactivate(int chunk) {
+    Chunk& c = mChunks[chunk];
+    if (c.tiles) {
+        c.tiles->pack(c.packed);
+        c.packedCount = c.tiles->count();
+        c.tiles.reset();
+    }
+}
+
+/**
+ * @brief Activate chunks near the view, pack the far ones
+ *          Chunks between the two distances keep their state, so a
+ *          camera sitting on a chunk border does not thrash
+ * 
+ * @param view Camera rectangle in world coordinates
+ */
+void World::stream(const sf::FloatRect& view) {
+    float chunkPixels = getChunkPixels();
+    sf::FloatRect near(view.left - ACTIVE_MARGIN * chunkPixels, view.top - ACTIVE_MARGIN * chunkPixels,
+                       view.width + 2 * ACTIVE_MARGIN * chunkPixels, view.height + 2 * ACTIVE_MARGIN * chunkPixels);
+    sf::FloatRect far(near.left - chunkPixels, near.top - chunkPixels,
+                      near.width + 2 * chunkPixels, near.height + 2 * chunkPixels);
+
+    for (int chunk = 0; chunk < getChunkCount(); chunk++) {
+        sf::FloatRect rect = getChunkRect(chunk);
+        if (rect.intersects(near)) {
+            activate(chunk);
+        } else if (!rect.intersects(far)) {
+            deactivate(chunk);
+        }
+    }
+}
+
+/**
+ * @brief Bytes held by packed chunks (debug output)
+ */
+std::size_t World::packedBytes() const {
+    std::size_t bytes = 0;
+    for (const Chunk& c : mChunks) {
+        bytes += c.packed.size();
+    }
+    return bytes;
+}
+
+// ===== SAVE STATES =====
+
+/**
+ * @brief Every mushroom as (world cell, tile byte), in cell order
+ *          Packed chunks are read from their runs, without unpacking
+ */
+void World::collectMushrooms(std::vector<std::pair<int, std::uint8_t>>& mushrooms) const {
+    mushrooms.clear();
+    for (int chunk = 0; chunk < getChunkCount(); chunk++) {
+        const Chunk& c = mChunks[chunk];
+        if (c.tiles) {
+            for (int local = 0; local < c.tiles->getCellCount(); local++) {
+                if (!c.tiles->isEmpty(local)) {
+                    mushrooms.emplace_back(globalCell(chunk, local), c.tiles->tile(local));
+                }
+            }
+            continue;
+        }
+
+        // Packed: read the runs in place
+        int local = 0;
+        for (std::size_t i = 0; i + 1 < c.packed.size(); i += 2) {
+            if (c.packed[i + 1] & MushroomField::HEALTH_MASK) {
+                for (int run = 0; run < c.packed[i]; run++) {
+                    mushrooms.emplace_back(globalCell(chunk, local + run), c.packed[i + 1]);
+                }
+            }
+            local += c.packed[i];
+        }
+    }
+    std::sort(mushrooms.begin(), mushrooms.end());
+}
+
+/**
+ * @brief Write every mushroom: cell gaps as varints, then 4-bit tiles
+ *          (health + poison flag) packed two to a byte
+ * 
+ * @param out Save state being written
+ */
+void World::saveState(SaveWriter& out) const {
+    std::vector<std::pair<int, std::uint8_t>> mushrooms;
+    collectMushrooms(mushrooms);
+
+    out.writeVarint(mColumns);
+    out.writeVarint(mRows);
+    out.writeVarint(mushrooms.size());
+
+    int previous = -1;
+    for (const auto& mushroom : mushrooms) {
+        out.writeVarint(mushroom.first - previous - 1);
+        previous = mushroom.first;
+    }
+    for (const auto& mushroom : mushrooms) {
+        out.writeBits(mushroom.second, 4);
+    }
+    out.flushBits();
+}
+
+/**
+ * @brief Read the mushrooms of a save state without touching the world
+ * 
+ * @param in Save state being read
+ * @param saved Receives the cells and tiles, for applyState()
+ * @return false if the section is damaged or the playfield size differs
+ */
+bool World::parseState(SaveReader& in, SavedMushrooms& saved) const {
+    const int cellCount = mColumns * mRows;
+    if (static_cast<int>(in.readVarint()) != mColumns || static_cast<int>(in.readVarint()) != mRows) {
+        return false;
+    }
+
+    std::size_t count = in.readCount(cellCount);
+    saved.cells.resize(count);
+    int cell = -1;
+    for (std::size_t i = 0; i < count; i++) {
+        cell += static_cast<int>(in.readVarint()) + 1;
+        if (cell < 0 || cell >= cellCount) {
+            return false;
+        }
+        saved.cells[i] = cell;
+    }
+
+    saved.tiles.resize(count);
+    for (std::size_t i = 0; i < count; i++) {
+        saved.tiles[i] = static_cast<std::uint8_t>(in.readBits(4));
+    }
+    in.alignBits();
+    return in.ok();
+}
+
+/**
+ * @brief Replace every mushroom with ones parseState() read
+ * 
+ * @param saved Output of a successful parseState()
+ * @param placedCells Receives every cell that now holds a mushroom
+ */
+void World::applyState(const SavedMushrooms& saved, std::vector<int>& placedCells) {
+    // Clear through hit() so the flow field follows
+    for (int chunk = 0; chunk < getChunkCount(); chunk++) {
+        MushroomField& field = activate(chunk);
+        for (int local = 0; local < field.getCellCount(); local++) {
+            if (!field.isEmpty(local)) {
+                hit(globalCell(chunk, local), MushroomField::HEALTH_MASK);
+            }
+        }
+    }
+
+    placedCells.clear();
+    for (std::size_t i = 0; i < saved.cells.size(); i++) {
+        int hp = saved.tiles[i] & MushroomField::HEALTH_MASK;
+        bool poisoned = (saved.tiles[i] & MushroomField::SUPER_FLAG) != 0;
+        if (hp > 0 && place(saved.cells[i], hp, poisoned)) {
+            placedCells.push_back(saved.cells[i]);
+        }
+    }
+}
+
+/**
+ * @brief Make the mushrooms match ones parseState() read, touching only
+ *          the cells that differ (for stepping back a tick at a time)
+ *          Only chunks with a changed cell are unpacked
+ * 
+ * @param saved Output of a successful parseState()
+ * @param changedCells Receives every cell whose tile changed
+ */
+void World::restoreState(const SavedMushrooms& saved, std::vector<int>& changedCells) {
+    std::vector<std::pair<int, std::uint8_t>> current;
+    collectMushrooms(current);
+
+    // Both lists are in cell order: walk them side by side
+    changedCells.clear();
+    std::size_t c = 0, s = 0;
+    while (c < current.size() || s < saved.cells.size()) {
+        int currentCell = c < current.size() ? current[c].first : mColumns * mRows;
+        int savedCell = s < saved.cells.size() ? saved.cells[s] : mColumns * mRows;
+        int cell = std::min(currentCell, savedCell);
+        std::uint8_t now = (currentCell == cell) ? current[c++].second : 0;
+        std::uint8_t target = (savedCell == cell) ? saved.tiles[s++] : 0;
+        if ((target & MushroomField::HEALTH_MASK) == 0) {
+            target = 0;
+        }
+        if (now == target) {
+            continue;
+        }
+
+        // Through hit() and place() so the flow field follows
+        if (now != 0) {
+            hit(cell, MushroomField::HEALTH_MASK);
+        }
+        if (target != 0) {
+            place(cell, target & MushroomField::HEALTH_MASK, (target & MushroomField::SUPER_FLAG) != 0);
+        }
+        changedCells.push_back(cell);
+    }
+}
+
+/**
+ * @brief Replace every mushroom with the ones in a save state
+ *          Nothing changes unless the whole section reads back cleanly
+ * 
+ * @param in Save state being read
+ * @param placedCells Receives every cell that now holds a mushroom
+ * @return false if the section is damaged or the playfield size differs
+ */
+bool World::loadState(SaveReader& in, std::vector<int>& placedCells) {
+    SavedMushrooms saved;
+    if (!parseState(in, saved)) {
+        return false;
+    }
+    applyState(saved, placedCells);
+    return true;
+}
+
+/**
+ * @brief Feed every chunk's tiles into the tick checksum, one entity per chunk
+ *          Hashes the runs MushroomField::pack() writes, so a chunk hashes
+ *          the same whether it is active or packed, without unpacking it
+ * 
+ * @param sum Checksum of the current tick
+ */
+void World::hashState(StateChecksum& sum) const {
+    for (int chunk = 0; chunk < getChunkCount(); chunk++) {
+        const Chunk& c = mChunks[chunk];
+        sum.beginEntity("chunk", chunk);
+
+        if (!c.tiles) {
+            for (std::size_t i = 0; i + 1 < c.packed.size(); i += 2) {
+                sum.add(static_cast<std::uint64_t>(c.packed[i]) << 8 | c.packed[i + 1]);
+            }
+            continue;
+        }
+
+        const MushroomField& tiles = *c.tiles;
+        int local = 0;
+        while (local < tiles.getCellCount()) {
+            std::uint8_t value = tiles.tile(local);
+            int run = 1;
+            while (local + run < tiles.getCellCount() && tiles.tile(local + run) == value && run < 255) {
+                run++;
+            }
+            sum.add(static_cast<std::uint64_t>(run) << 8 | value);
+            local += run;
+        }
+    }
+}
+
+// ===== MUSHROOMS =====
+
+/**
+ * @brief Whether a world cell has no mushroom
+ */
+bool World::isEmpty(int cell) const {
+    int chunk = chunkOfCell(cell);
+    return (tileAt(chunk, localCell(cell, chunk)) & MushroomField::HEALTH_MASK) == 0;
+}
+
+/**
+ * @brief Mushrooms in the whole playfield
+ */
+std::size_t World::count() const {
+    std::size_t total = 0;
+    for (const Chunk& c : mChunks) {
+        total += c.tiles ? c.tiles->count() : c.packedCount;
+    }
+    return total;
+}
+
+/**
+ * @brief Put a mushroom in an empty world cell (main thread only)
+ */
+bool World::place(int cell, int hp, bool isSuper) {
+    int chunk = chunkOfCell(cell);
+    if (!activate(chunk).place(localCell(cell, chunk), hp, isSuper)) {
+        return false;
+    }
+    mFlow.cellChanged(cell % mColumns, cell / mColumns, true, isSuper);
+    return true;
+}
+
+/**
+ * @brief Damage the mushroom in a world cell (main thread only)
+ * @return true if it was destroyed
+ */
+bool World::hit(int cell, int dmg) {
+    int chunk = chunkOfCell(cell);
+    if (!activate(chunk).hit(localCell(cell, chunk), dmg)) {
+        return false;
+    }
+    mFlow.cellChanged(cell % mColumns, cell / mColumns, false);
+    return true;
+}
+
+/**
+ * @brief Poison the mushroom in a world cell (main thread only)
+ * @return true if it changed
+ */
+bool World::poison(int cell) {
+    int chunk = chunkOfCell(cell);
+    if (!activate(chunk).poison(localCell(cell, chunk))) {
+        return false;
+    }
+    mFlow.cellChanged(cell % mColumns, cell / mColumns, true, true);
+    return true;
+}
+
+/**
+ * @brief Whether a world cell holds a poisoned mushroom
+ */
+bool World::isPoisoned(int cell) const {
+    int chunk = chunkOfCell(cell);
+    return (tileAt(chunk, localCell(cell, chunk)) & MushroomField::SUPER_FLAG) != 0;
+}
+
+/**
+ * @brief World cell under a position
+ * @return Cell index, or -1 outside the playfield
+ */
+int World::cellAt(sf::Vector2f position) const {
+    int column = static_cast<int>(std::floor((position.x - mOrigin.x) / mCellSize));
+    int row = static_cast<int>(std::floor((position.y - mOrigin.y) / mCellSize));
+    if (column < 0 || row < 0 || column >= mColumns || row >= mRows) {
+        return -1;
+    }
+    return cellIndex(column, row);
+}
+
+/**
+ * @brief First mushroom a rectangle overlaps, lowest row first
+ * @return World cell, or -1 if none
+ */
+int World::firstHit(const sf::FloatRect& bounds) const {
+    int cx1, cy1, cx2, cy2;
+    if (!chunkRange(bounds, cx1, cy1, cx2, cy2)) {
+        return -1;
+    }
+
+    // Lower chunks first, so the lowest hit wins like inside one field
+    for (int cy = cy2; cy >= cy1; cy--) {
+        int best = -1;
+        for (int cx = cx1; cx <= cx2; cx++) {
+            int chunk = cy * mChunkColumns + cx;
+            const Chunk& c = mChunks[chunk];
+            int local = c.tiles ? c.tiles->firstHit(bounds) : packedHit(chunk, bounds, true);
+            if (local < 0) {
+                continue;
+            }
+
+            int cell = globalCell(chunk, local);
+            if (best < 0 || cell / mColumns > best / mColumns) {
+                best = cell;
+            }
+        }
+        if (best >= 0) {
+            return best;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Whether a rectangle overlaps any mushroom
+ */
+bool World::anyInRect(const sf::FloatRect& bounds) const {
+    int cx1, cy1, cx2, cy2;
+    if (!chunkRange(bounds, cx1, cy1, cx2, cy2)) {
+        return false;
+    }
+
+    for (int cy = cy1; cy <= cy2; cy++) {
+        for (int cx = cx1; cx <= cx2; cx++) {
+            const Chunk& c = mChunks[cy * mChunkColumns + cx];
+            bool any = c.tiles ? c.tiles->anyInRect(bounds) : packedHit(cy * mChunkColumns + cx, bounds, false) >= 0;
+            if (any) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Sprite of the mushroom in a world cell
+ */
+SpriteInstance World::spriteAt(int cell) const {
+    int chunk = chunkOfCell(cell);
+    sf::Vector2f position(mOrigin.x + (cell % mColumns) * mCellSize, mOrigin.y + (cell / mColumns) * mCellSize);
+    return MushroomField::tileSprite(tileAt(chunk, localCell(cell, chunk)), position, mCellSize);
+}
+
+/**
+ * @brief Cell a rectangle exactly covers
+ * @return World cell, or -1 if the rectangle is not one whole grid cell
+ */
+int World::alignedCell(const sf::FloatRect& bounds) const {
+    if (bounds.width != mCellSize || bounds.height != mCellSize) {
+        return -1;
+    }
+
+    float x = (bounds.left - mOrigin.x) / mCellSize;
+    float y = (bounds.top - mOrigin.y) / mCellSize;
+    int column = static_cast<int>(x);
+    int row = static_cast<int>(y);
+    if (x < 0 || y < 0 || column != x || row != y || column >= mColumns || row >= mRows) {
+        return -1;
+    }
+    return cellIndex(column, row);
+}
+
+// ===== ENTITY LISTS =====
+
+/**
+ * @brief Rebuild every chunk's entity list from collider positions
+ *          Entities outside the playfield go to the nearest edge chunk
+ */
+void World::indexEntities(const ecs::Registry& reg) {
+    for (Chunk& c : mChunks) {
+        c.entities.clear();
+    }
+
+    float chunkPixels = getChunkPixels();
+    for (std::size_t i = 0; i < reg.colliders.size(); i++) {
+        ecs::Entity e = reg.colliders.entityAt(i);
+        sf::Vector2f position = reg.transforms.get(e).position;
+
+        int cx = static_cast<int>(std::floor((position.x - mOrigin.x) / chunkPixels));
+        int cy = static_cast<int>(std::floor((position.y - mOrigin.y) / chunkPixels));
+        cx = std::max(0, std::min(mChunkColumns - 1, cx));
+        cy = std::max(0, std::min(mChunkRows - 1, cy));
+
+        mChunks[cy * mChunkColumns + cx].entities.push_back(e);
+    }
+}
+
+/**
+ * @brief Entities listed in every chunk a rectangle overlaps
+ *          Lists go by position, so pad the rectangle by the largest
+ *          sprite extent to catch sprites that stick out of their chunk
+ * @param out Receives the entities (not cleared first)
+ */
+void World::collectEntities(const sf::FloatRect& region, std::vector<ecs::Entity>& out) const {
+    int cx1, cy1, cx2, cy2;
+    if (!chunkRange(region, cx1, cy1, cx2, cy2)) {
+        return;
+    }
+
+    for (int cy = cy1; cy <= cy2; cy++) {
+        for (int cx = cx1; cx <= cx2; cx++) {
+            const std::vector<ecs::Entity>& entities = mChunks[cy * mChunkColumns + cx].entities;
+            out.insert(out.end(), entities.begin(), entities.end());
+        }
+    }
+}
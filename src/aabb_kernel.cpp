@@ -0,0 +1,193 @@
+/**
+ * @file aabb_kernel.cpp
+ * @author Roman Salazar
+ * @brief SIMD and scalar implementations of the batch AABB overlap test
+ * @version 1.0
+ * @date 2025-12-10
+ *
+ * @copyright Copyright (c) 2025
+ */
+
+#include "../includes/aabb_kernel.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AABB_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+namespace aabb {
+
+namespace {
+
+typedef void (*KernelFn)(float, float, float, float,
+                         const float*, const float*, const float*, const float*,
+                         std::size_t, std::uint8_t*);
+
+/**
+ * @brief Scalar test of boxes [begin, count), ORed into the mask bytes
+ */
+void scalarRange(float left, float top, float right, float bottom,
+                 const float* minX, const float* minY, const float* maxX, const float* maxY,
+                 std::size_t begin, std::size_t count, std::uint8_t* masks) {
+    std::size_t i = begin;
+    while (i < count) {
+        // Build each byte in a register, then store it once
+        std::size_t byteEnd = (i / 8 + 1) * 8;
+        if (byteEnd > count) {
+            byteEnd = count;
+        }
+
+        unsigned bits = masks[i / 8];
+        for (; i < byteEnd; i++) {
+            // & instead of && keeps the loop branch-free
+            unsigned hit = (minX[i] < right) & (maxX[i] > left) & (minY[i] < bottom) & (maxY[i] > top);
+            bits |= hit << (i % 8);
+        }
+        masks[(i - 1) / 8] = static_cast<std::uint8_t>(bits);
+    }
+}
+
+/**
+ * @brief Zero the last mask byte if it is partial: the scalar tail ORs into it
+ */
+inline void clearTail(std::size_t count, std::uint8_t* masks) {
+    if (count % 8 != 0) {
+        masks[count / 8] = 0;
+    }
+}
+
+#ifdef AABB_KERNEL_X86
+
+/**
+ * @brief SSE2: 4 boxes per step, two steps per mask byte
+ */
+void sse2Kernel(float left, float top, float right, float bottom,
+                const float* minX, const float* minY, const float* maxX, const float* maxY,
+                std::size_t count, std::uint8_t* masks) {
+    const __m128 l = _mm_set1_ps(left);
+    const __m128 t = _mm_set1_ps(top);
+    const __m128 r = _mm_set1_ps(right);
+    const __m128 b = _mm_set1_ps(bottom);
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        int bits = 0;
+        for (std::size_t half = 0; half < 8; half += 4) {
+            __m128 hit = _mm_and_ps(
+                _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(minX + i + half), r),
+                           _mm_cmpgt_ps(_mm_loadu_ps(maxX + i + half), l)),
+                _mm_and_ps(_mm_cmplt_ps(_mm_loadu_ps(minY + i + half), b),
+                           _mm_cmpgt_ps(_mm_loadu_ps(maxY + i + half), t)));
+            bits |= _mm_movemask_ps(hit) << half;
+        }
+        masks[i / 8] = static_cast<std::uint8_t>(bits);
+    }
+
+    scalarRange(left, top, right, bottom, minX, minY, maxX, maxY, i, count, masks);
+}
+
+/**
+ * @brief AVX2: 8 boxes per step, one mask byte per step
+ */
+__attribute__((target("avx2")))
+void avx2Kernel(float left, float top, float right, float bottom,
+                const float* minX, const float* minY, const float* maxX, const float* maxY,
+                std::size_t count, std::uint8_t* masks) {
+    const __m256 l = _mm256_set1_ps(left);
+    const __m256 t = _mm256_set1_ps(top);
+    const __m256 r = _mm256_set1_ps(right);
+    const __m256 b = _mm256_set1_ps(bottom);
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 hit = _mm256_and_ps(
+            _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(minX + i), r, _CMP_LT_OQ),
+                          _mm256_cmp_ps(_mm256_loadu_ps(maxX + i), l, _CMP_GT_OQ)),
+            _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(minY + i), b, _CMP_LT_OQ),
+                          _mm256_cmp_ps(_mm256_loadu_ps(maxY + i), t, _CMP_GT_OQ)));
+        masks[i / 8] = static_cast<std::uint8_t>(_mm256_movemask_ps(hit));
+    }
+
+    scalarRange(left, top, right, bottom, minX, minY, maxX, maxY, i, count, masks);
+}
+
+#endif // AABB_KERNEL_X86
+
+/**
+ * @brief Pick the widest kernel this CPU supports
+ */
+KernelFn selectKernel(const char** name) {
+#ifdef AABB_KERNEL_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        *name = "AVX2";
+        return avx2Kernel;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        *name = "SSE2";
+        return sse2Kernel;
+    }
+#endif
+    *name = "scalar";
+    return overlapMasksScalar;
+}
+
+struct Dispatch {
+    const char* name;
+    KernelFn kernel;
+    Dispatch() { kernel = selectKernel(&name); }
+};
+
+/**
+ * @brief Chosen on first use (thread-safe static init)
+ */
+const Dispatch& dispatch() {
+    static const Dispatch instance;
+    return instance;
+}
+
+} // namespace
+
+void overlapMasksScalar(float left, float top, float right, float bottom,
+                        const float* minX, const float* minY, const float* maxX, const float* maxY,
+                        std::size_t count, std::uint8_t* masks) {
+    std::memset(masks, 0, maskBytes(count));
+    scalarRange(left, top, right, bottom, minX, minY, maxX, maxY, 0, count, masks);
+}
+
+void overlapMasks(float left, float top, float right, float bottom,
+                  const float* minX, const float* minY, const float* maxX, const float* maxY,
+                  std::size_t count, std::uint8_t* masks) {
+    clearTail(count, masks);
+    dispatch().kernel(left, top, right, bottom, minX, minY, maxX, maxY, count, masks);
+}
+
+#ifdef AABB_KERNEL_X86
+
+void overlapMasksSse2(float left, float top, float right, float bottom,
+                      const float* minX, const float* minY, const float* maxX, const float* maxY,
+                      std::size_t count, std::uint8_t* masks) {
+    clearTail(count, masks);
+    sse2Kernel(left, top, right, bottom, minX, minY, maxX, maxY, count, masks);
+}
+
+void overlapMasksAvx2(float left, float top, float right, float bottom,
+                      const float* minX, const float* minY, const float* maxX, const float* maxY,
+                      std::size_t count, std::uint8_t* masks) {
+    clearTail(count, masks);
+    avx2Kernel(left, top, right, bottom, minX, minY, maxX, maxY, count, masks);
+}
+
+bool hasAvx2() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif // AABB_KERNEL_X86
+
+const char* implementationName() {
+    return dispatch().name;
+}
+
+} // namespace aabb
@@ -18,16 +18,18 @@ float Bullet::shootCooldown = 0.1f;
 
 /**
  * @brief The actual shoot function
- * Handles keyboard input for space bar and creates bullets.
+ * Fires while space is held, or once for a tap shorter than a frame.
  * @param playerPos Player position to spawn bullet from
  * @param deltaTime Time since last frame
  * @param bulletTex Bullet texture reference
+ * @param input This tick's buttons
+ * @return true if a bullet was fired this tick
  */
-void Bullet::shoot(sf::Vector2f playerPos, float deltaTime, sf::Texture& bulletTex)
+bool Bullet::shoot(sf::Vector2f playerPos, float deltaTime, sf::Texture& bulletTex, const InputSnapshot& input)
 {
     timeSinceLastShot += deltaTime;
 
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space) && timeSinceLastShot >= shootCooldown)
+    if (input.isActive(INPUT_FIRE) && timeSinceLastShot >= shootCooldown)
     {
         // Center bullet on player
         sf::Vector2i bulletStart(
@@ -35,12 +37,16 @@ void Bullet::shoot(sf::Vector2f playerPos, float deltaTime, sf::Texture& bulletT
             playerPos.y
         );
 
-        Bullet* newBullet = new Bullet(bulletTex, bulletStart, 500.0f);  
+        // Bullets used to be integrated twice per frame at 500; one pass at
+        // 1000 keeps the same on-screen speed
+        Bullet* newBullet = new Bullet(bulletTex, bulletStart, SPEED);
         bullets.push_back(newBullet);
 
         std::cout << "New bullet created at (" 
                   << bulletStart.x << ", " << bulletStart.y << ")\n";
 
         timeSinceLastShot = 0.0f;
+        return true;
     }
+    return false;
 }
\ No newline at end of file
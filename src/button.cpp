@@ -151,42 +151,14 @@ std::string Button::getText() const {
 }
 
 /**
- * @brief This function update the button state and/or look
+ * @brief change the button state and/or look
+ *  Which button the mouse is over is decided by ButtonGroup, which only
+ *  calls this on the buttons whose state actually changed
  * 
- * @param e 
- * @param window 
+ * @param state 
  */
-void Button::update(sf::Event &e, sf::RenderWindow &window) {
-    // get position of the mouse
-    // sf::Vector2i mousePosition = sf::Mouse::getPosition(window);
-    sf::Vector2i mPos = sf::Mouse::getPosition(window);
-    sf::Vector2f mousePosition = window.mapPixelToCoords(mPos, window.getDefaultView());
-    bool mouseInButton = mousePosition.x >= mButton.getPosition().x - mButton.getGlobalBounds().width / 2 && mousePosition.x <= mButton.getPosition().x + mButton.getGlobalBounds().width / 2 && mousePosition.y >= mButton.getPosition().y - mButton.getGlobalBounds().height / 2 && mousePosition.y <= mButton.getPosition().y + mButton.getGlobalBounds().height / 2;
-    if (e.type == sf::Event::MouseMoved) {
-        if (mouseInButton) {
-            mBtnState = buttonState::hovered;
-        } else {
-            mBtnState = buttonState::normalButton;
-        }
-    }
-    if (e.type == sf::Event::MouseButtonPressed) {
-        if (e.mouseButton.button == sf::Mouse::Left) {
-            if (mouseInButton) {
-                mBtnState = buttonState::clicked;
-            } else {
-                mBtnState = buttonState::normalButton;
-            }
-        }
-    }
-    if (e.type == sf::Event::MouseButtonReleased) {
-        if (e.mouseButton.button == sf::Mouse::Left) {
-            if (mouseInButton) {
-                mBtnState = buttonState::hovered;
-            } else {
-                mBtnState = buttonState::normalButton;
-            }
-        }
-    }
+void Button::setState(buttonState state) {
+    mBtnState = state;
     switch (mBtnState) {
     case normalButton: {
         mButton.setRotation(0);
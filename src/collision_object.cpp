@@ -7,74 +7,83 @@
 
 #include "../includes/collision_object.h"
 
-std::vector<c_obj*> c_obj::objects;
-
 /**
  * @brief Default constructor
  */
 c_obj::c_obj() {
-    mTexture = nullptr;
-    mName = "Default";
-    objects.push_back(this);
+    ecs::Registry& reg = ecs::registry();
+    mEntity = reg.create();
+
+    mName = ecs::internName(ecs::typeName(ecs::EntityType::Default));
+
+    ecs::Collider collider;
+    collider.object = this;
+
+    reg.transforms.add(mEntity, ecs::Transform());
+    reg.sprites.add(mEntity, ecs::Sprite());
+    reg.addCollider(mEntity, collider);
 }
 
 /**
  * @brief Construct a new c_obj object
  */
-c_obj::c_obj(sf::Texture& texture, sf::IntRect spriteTexture, sf::Vector2f pos, std::string name) {
-    mSprite.setTexture(texture);
-    mTexture = &texture;
-    mName = name;
+c_obj::c_obj(sf::Texture& texture, sf::IntRect spriteTexture, sf::Vector2f pos, ecs::EntityType type) {
+    ecs::Registry& reg = ecs::registry();
+    mEntity = reg.create();
+
+    ecs::Transform transform;
+    transform.position = pos;
+    transform.origin = sf::Vector2f(spriteTexture.height / 2, spriteTexture.width / 2);
 
-    sf::Vector2u imageSize(spriteTexture.height, spriteTexture.width);
-    mSprite.setOrigin(imageSize.x/2, imageSize.y/2);
-    mSprite.setTextureRect(spriteTexture);
+    ecs::Sprite sprite;
+    sprite.texture = &texture;
+    sprite.rect = spriteTexture;
 
-    mSprite.setPosition(pos.x, pos.y);
-    mPosition = pos;
+    mName = ecs::internName(ecs::typeName(type));
 
-    objects.push_back(this);
+    ecs::Collider collider;
+    collider.type = type;
+    collider.category = ecs::layerOf(type);
+    collider.dynamic = (collider.category & ecs::LAYER_CENTIPEDE) != 0;  // Centipedes step every tick
+    collider.object = this;
+
+    reg.transforms.add(mEntity, transform);
+    reg.sprites.add(mEntity, sprite);
+    reg.addCollider(mEntity, collider);
 }
 
 c_obj::~c_obj() {
-    auto it = std::find(objects.begin(),objects.end(),this);
-    if(it != objects.end())
-    {
-        objects.erase(it);
-    }
-    
+    ecs::registry().destroy(mEntity);
 }
 
 
 /**
  * @brief Gets an array of colliding sprites
+ * @param mask Collision layers to report (ecs::CollisionLayer bits)
  * @return Vector of colliding c_obj pointers
  */
-std::vector<c_obj*> c_obj::getCollided() {
-    std::vector<c_obj*> collisions;
-    sf::FloatRect targetRegion = mSprite.getGlobalBounds();
-    for (c_obj* obj: objects) {
-        sf::FloatRect compareRegion = obj->mSprite.getGlobalBounds();
-        if (targetRegion.intersects(compareRegion)) { // This simply stores a colliding object inside of the "collisions" vector
-            collisions.push_back(obj);
-        }
-    }
-
-    return collisions;
+std::vector<c_obj*> c_obj::getCollided(std::uint32_t mask) {
+    return getCollided(getBounds(), mask);
 }
 
 /**
  * @brief Get collided objects within region
+ *          Tests the packed cached bounds; objects outside the mask
+ *          are skipped before any bounds are read
  * @param region Region to check collisions in
+ * @param mask Collision layers to report (ecs::CollisionLayer bits)
  * @return Vector of colliding c_obj pointers
  */
-std::vector<c_obj*> c_obj::getCollided(sf::FloatRect region) {
+std::vector<c_obj*> c_obj::getCollided(sf::FloatRect region, std::uint32_t mask) {
+    const ecs::Registry& reg = ecs::registry();
+
+    std::vector<ecs::Entity> hits;
+    reg.query(region, mask, hits);
+
     std::vector<c_obj*> collisions;
-    for (c_obj* obj: objects) {
-        sf::FloatRect compareRegion = obj->mSprite.getGlobalBounds();
-        if (region.intersects(compareRegion)) {
-            collisions.push_back(obj);
-        }
+    collisions.reserve(hits.size());
+    for (ecs::Entity e : hits) {
+        collisions.push_back(reg.colliders.get(e).object);
     }
 
     return collisions;
@@ -85,8 +94,9 @@ std::vector<c_obj*> c_obj::getCollided(sf::FloatRect region) {
  * @param pos Position to set
  */
 void c_obj::setPosition(sf::Vector2f pos) {
-    mSprite.setPosition(pos.x, pos.y);
-    mPosition = pos;
+    ecs::Registry& reg = ecs::registry();
+    reg.transforms.get(mEntity).position = pos;
+    reg.markBoundsDirty(mEntity);
 }
 
 /**
@@ -94,14 +104,42 @@ void c_obj::setPosition(sf::Vector2f pos) {
  * @param spriteTexture TextureRect to set
  */
 void c_obj::setSpriteRect(sf::IntRect spriteTexture) {
-    mSprite.setTextureRect(spriteTexture);
+    ecs::Registry& reg = ecs::registry();
+    sf::IntRect& rect = reg.sprites.get(mEntity).rect;
+
+    // Only the rect's size affects the bounds, not where it sits in the atlas
+    if (rect.width != spriteTexture.width || rect.height != spriteTexture.height) {
+        reg.markBoundsDirty(mEntity);
+    }
+    rect = spriteTexture;
 }
 
 /**
  * @brief Sets sprite scale
  */
 void c_obj::setScale(sf::Vector2i factor) {
-    mSprite.setScale(sf::Vector2f(factor.x, factor.y));
+    ecs::Registry& reg = ecs::registry();
+    reg.transforms.get(mEntity).scale = sf::Vector2f(factor.x, factor.y);
+    reg.markBoundsDirty(mEntity);
+}
+
+/**
+ * @brief Build an sf::Sprite from the entity's components
+ */
+sf::Sprite c_obj::getSprite() const {
+    const ecs::Registry& reg = ecs::registry();
+    const ecs::Transform& transform = reg.transforms.get(mEntity);
+    const ecs::Sprite& sprite = reg.sprites.get(mEntity);
+
+    sf::Sprite result;
+    if (sprite.texture != nullptr) {
+        result.setTexture(*sprite.texture);
+    }
+    result.setTextureRect(sprite.rect);
+    result.setOrigin(transform.origin);
+    result.setScale(transform.scale);
+    result.setPosition(transform.position);
+    return result;
 }
 
 /**
@@ -111,5 +149,5 @@ void c_obj::setScale(sf::Vector2i factor) {
  * @param states 
  */
 void c_obj::draw(sf::RenderTarget& target,sf::RenderStates states) const {
-    target.draw(mSprite, states);
+    target.draw(getSprite(), states);
 }
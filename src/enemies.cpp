@@ -0,0 +1,492 @@
+/**
+ * @file    enemies.cpp
+ * @author  Balin Becker
+ * @brief   Enemy system definitions
+ * @date    2025-12-12
+ */
+
+#include "../includes/enemies.h"
+#include <cmath>
+
+namespace {
+
+// Enemies are one grid cell: 8x8 atlas cells at 2x
+const sf::Vector2f ENEMY_SCALE(2, 2);
+const float ENEMY_SIZE = atlas::CELL * 2;
+
+// Spiders stay in the player area at the bottom of the field
+const float SPIDER_BAND = 200.0f;
+
+inline int kindIndex(ecs::EntityType type) {
+    return static_cast<int>(type) - static_cast<int>(ecs::EntityType::Flea);
+}
+
+}
+
+/**
+ * @brief Reserve every kind's array up front
+ */
+EnemySystem::EnemySystem(sf::Texture& texture) : mTexture(&texture), mRandom(0x9E3779B9u) {
+    for (int kind = 0; kind < static_cast<int>(EnemyKind::Count); kind++) {
+        mEnemies[kind].reserve(CAPACITY);
+        mSpawnTimers[kind] = 0.0f;
+    }
+}
+
+/**
+ * @brief Destroy every enemy entity
+ */
+EnemySystem::~EnemySystem() {
+    clear();
+}
+
+// ===== SPAWNING =====
+
+/**
+ * @brief Create one enemy at its kind's entry point
+ * 
+ * @param region Playfield rectangle
+ * @return false if the kind's pool is full
+ */
+bool EnemySystem::spawn(EnemyKind kind, const sf::FloatRect& region) {
+    std::vector<Enemy>& pool = mEnemies[static_cast<int>(kind)];
+    if (pool.size() >= CAPACITY) {
+        return false;
+    }
+    const EnemyDef& def = ENEMY_DEFS[static_cast<int>(kind)];
+
+    int columns = static_cast<int>(region.width / ENEMY_SIZE);
+    int rows = static_cast<int>(region.height / ENEMY_SIZE);
+    bool fromLeft = (random() & 1) != 0;
+    float right = region.left + region.width;
+    float bottom = region.top + region.height;
+
+    sf::Vector2f position;
+    sf::Vector2f velocity;
+    switch (kind) {
+        case EnemyKind::Flea:
+            // Drops in from above a random column
+            position = sf::Vector2f(region.left + (random() % columns) * ENEMY_SIZE, region.top - ENEMY_SIZE);
+            velocity = sf::Vector2f(0, def.speed);
+            break;
+        case EnemyKind::Spider:
+            // Enters from a side, somewhere in the player area
+            position = sf::Vector2f(fromLeft ? region.left - ENEMY_SIZE : right,
+                                    randomRange(bottom - SPIDER_BAND, bottom - ENEMY_SIZE));
+            velocity = sf::Vector2f(fromLeft ? def.speed / 2 : -def.speed / 2, def.speed);
+            break;
+        default:
+            // Scorpion: crosses one row of the upper half
+            position = sf::Vector2f(fromLeft ? region.left - ENEMY_SIZE : right,
+                                    region.top + (random() % std::max(1, rows / 2)) * ENEMY_SIZE);
+            velocity = sf::Vector2f(fromLeft ? def.speed : -def.speed, 0);
+            break;
+    }
+
+    Enemy& enemy = create(kind, position, velocity);
+    enemy.timer = randomRange(0.3f, 1.0f);
+    return true;
+}
+
+/**
+ * @brief Create an enemy's entity with all its components
+ * 
+ * @param position Top-left corner
+ * @param velocity Pixels per second
+ * @return The new pool entry (timer 0, outside every cell)
+ */
+EnemySystem::Enemy& EnemySystem::create(EnemyKind kind, sf::Vector2f position, sf::Vector2f velocity) {
+    const EnemyDef& def = ENEMY_DEFS[static_cast<int>(kind)];
+    ecs::Registry& reg = ecs::registry();
+    ecs::Entity e = reg.create();
+
+    ecs::Transform transform;
+    transform.position = position;
+    transform.scale = ENEMY_SCALE;
+    reg.transforms.add(e, transform);
+
+    ecs::Sprite sprite;
+    sprite.texture = mTexture;
+    sprite.rect = def.clip->frames[0].rect();
+    reg.sprites.add(e, sprite);
+
+    ecs::Collider collider;
+    collider.type = def.type;
+    collider.category = ecs::layerOf(def.type);
+    reg.addCollider(e, collider);
+
+    ecs::Animation animation;
+    animation.table = def.clip->frames;
+    animation.frames = def.clip->count;
+    animation.frameTime = def.clip->frameTime;
+    reg.animations.add(e, animation);
+
+    ecs::Velocity vel;
+    vel.value = velocity;
+    reg.velocities.add(e, vel);
+
+    ecs::Health health;
+    health.hp = def.hp;
+    reg.healths.add(e, health);
+
+    Enemy enemy;
+    enemy.entity = e;
+    enemy.lastCell = -1;
+    enemy.timer = 0.0f;
+
+    std::vector<Enemy>& pool = mEnemies[static_cast<int>(kind)];
+    pool.push_back(enemy);
+    return pool.back();
+}
+
+/**
+ * @brief Normal-play spawning: one enemy per kind every spawnEvery seconds
+ */
+void EnemySystem::spawnTimed(float dt, const sf::FloatRect& region) {
+    for (int kind = 0; kind < static_cast<int>(EnemyKind::Count); kind++) {
+        mSpawnTimers[kind] += dt;
+        if (mSpawnTimers[kind] >= ENEMY_DEFS[kind].spawnEvery) {
+            mSpawnTimers[kind] -= ENEMY_DEFS[kind].spawnEvery;
+            spawn(static_cast<EnemyKind>(kind), region);
+        }
+    }
+}
+
+// ===== UPDATE KERNELS =====
+
+/**
+ * @brief Run every kind's kernel
+ *          Kernels only steer (write velocities) and change mushrooms;
+ *          the movement system moves enemies afterwards. Main thread only.
+ * 
+ * @param changedCells Receives every mushroom cell an enemy changed
+ */
+void EnemySystem::update(float dt, World& world, const sf::FloatRect& region, std::vector<int>& changedCells) {
+    updateFleas(world, region, changedCells);
+    updateSpiders(dt, world, region, changedCells);
+    updateScorpions(world, region, changedCells);
+}
+
+/**
+ * @brief Fleas - fall, drop a mushroom in one of four empty cells above
+ *          the player area, vanish at the bottom
+ */
+void EnemySystem::updateFleas(World& world, const sf::FloatRect& region, std::vector<int>& changedCells) {
+    ecs::Registry& reg = ecs::registry();
+    float bottom = region.top + region.height;
+
+    for (Enemy& flea : mEnemies[static_cast<int>(EnemyKind::Flea)]) {
+        sf::Vector2f position = reg.transforms.get(flea.entity).position;
+        if (position.y > bottom) {
+            reg.healths.get(flea.entity).hp = 0;
+            continue;
+        }
+
+        int cell = world.cellAt(position);
+        if (cell < 0 || cell == flea.lastCell) {
+            continue;
+        }
+        flea.lastCell = cell;
+
+        if (position.y < bottom - SPIDER_BAND && (random() & 3) == 0 && world.place(cell)) {
+            changedCells.push_back(cell);
+        }
+    }
+}
+
+/**
+ * @brief Spiders - bounce inside the player area, turn at random,
+ *          eat every mushroom they pass over, leave at the far side
+ */
+void EnemySystem::updateSpiders(float dt, World& world, const sf::FloatRect& region, std::vector<int>& changedCells) {
+    ecs::Registry& reg = ecs::registry();
+    float right = region.left + region.width;
+    float bottom = region.top + region.height;
+
+    for (Enemy& spider : mEnemies[static_cast<int>(EnemyKind::Spider)]) {
+        sf::Vector2f position = reg.transforms.get(spider.entity).position;
+        sf::Vector2f& velocity = reg.velocities.get(spider.entity).value;
+
+        if ((velocity.x > 0 && position.x > right) || (velocity.x < 0 && position.x < region.left - ENEMY_SIZE)) {
+            reg.healths.get(spider.entity).hp = 0;
+            continue;
+        }
+
+        spider.timer -= dt;
+        if (position.y < bottom - SPIDER_BAND) {
+            velocity.y = std::abs(velocity.y);
+        } else if (position.y > bottom - ENEMY_SIZE) {
+            velocity.y = -std::abs(velocity.y);
+        } else if (spider.timer <= 0.0f) {
+            velocity.y = -velocity.y;
+            spider.timer = randomRange(0.3f, 1.0f);
+        }
+
+        int cell = world.cellAt(position + sf::Vector2f(ENEMY_SIZE / 2, ENEMY_SIZE / 2));
+        if (cell < 0 || cell == spider.lastCell) {
+            continue;
+        }
+        spider.lastCell = cell;
+
+        if (!world.isEmpty(cell) && world.hit(cell, atlas::MUSHROOM_MAX_HEALTH)) {
+            changedCells.push_back(cell);
+        }
+    }
+}
+
+/**
+ * @brief Scorpions - walk across their row, poisoning every mushroom
+ *          they touch, leave at the far side
+ */
+void EnemySystem::updateScorpions(World& world, const sf::FloatRect& region, std::vector<int>& changedCells) {
+    ecs::Registry& reg = ecs::registry();
+    float right = region.left + region.width;
+
+    for (Enemy& scorpion : mEnemies[static_cast<int>(EnemyKind::Scorpion)]) {
+        sf::Vector2f position = reg.transforms.get(scorpion.entity).position;
+        float vx = reg.velocities.get(scorpion.entity).value.x;
+
+        if ((vx > 0 && position.x > right) || (vx < 0 && position.x < region.left - ENEMY_SIZE)) {
+            reg.healths.get(scorpion.entity).hp = 0;
+            continue;
+        }
+
+        int cell = world.cellAt(position + sf::Vector2f(ENEMY_SIZE / 2, ENEMY_SIZE / 2));
+        if (cell < 0 || cell == scorpion.lastCell) {
+            continue;
+        }
+        scorpion.lastCell = cell;
+
+        if (world.poison(cell)) {
+            changedCells.push_back(cell);
+        }
+    }
+}
+
+// ===== DAMAGE AND REMOVAL =====
+
+/**
+ * @brief Whether a collider type belongs to this system
+ */
+bool EnemySystem::isEnemy(ecs::EntityType type) {
+    return type == ecs::EntityType::Flea || type == ecs::EntityType::Spider || type == ecs::EntityType::Scorpion;
+}
+
+/**
+ * @brief Whether an enemy entity still has health (not killed this tick)
+ */
+bool EnemySystem::isAlive(ecs::Entity e) const {
+    const ecs::Registry& reg = ecs::registry();
+    return reg.healths.has(e) && reg.healths.get(e).hp > 0;
+}
+
+/**
+ * @brief Take one hit point off an enemy
+ *          A wounded flea falls twice as fast
+ * @return Score for the kill, or 0 if it survived
+ */
+int EnemySystem::hit(ecs::Entity e) {
+    ecs::Registry& reg = ecs::registry();
+    ecs::EntityType type = reg.colliders.get(e).type;
+    int& hp = reg.healths.get(e).hp;
+
+    hp--;
+    if (hp <= 0) {
+        return ENEMY_DEFS[kindIndex(type)].score;
+    }
+    if (type == ecs::EntityType::Flea) {
+        reg.velocities.get(e).value *= 2.0f;
+    }
+    return 0;
+}
+
+/**
+ * @brief Kill an enemy outright (it touched the player), no score
+ *          removeDead() takes it out at the end of the tick
+ */
+void EnemySystem::kill(ecs::Entity e) {
+    ecs::registry().healths.get(e).hp = 0;
+}
+
+/**
+ * @brief Destroy enemies that were killed or left the field
+ *          Swap-and-pop, like the component arrays
+ */
+void EnemySystem::removeDead() {
+    ecs::Registry& reg = ecs::registry();
+
+    for (std::vector<Enemy>& pool : mEnemies) {
+        for (std::size_t i = pool.size(); i-- > 0;) {
+            if (reg.healths.get(pool[i].entity).hp > 0) {
+                continue;
+            }
+            reg.destroy(pool[i].entity);
+            pool[i] = pool.back();
+            pool.pop_back();
+        }
+    }
+}
+
+/**
+ * @brief Destroy every enemy
+ */
+void EnemySystem::clear() {
+    ecs::Registry& reg = ecs::registry();
+
+    for (std::vector<Enemy>& pool : mEnemies) {
+        for (const Enemy& enemy : pool) {
+            reg.destroy(enemy.entity);
+        }
+        pool.clear();
+    }
+}
+
+/**
+ * @brief Live enemies of every kind
+ */
+std::size_t EnemySystem::count() const {
+    std::size_t total = 0;
+    for (const std::vector<Enemy>& pool : mEnemies) {
+        total += pool.size();
+    }
+    return total;
+}
+
+// ===== SAVE STATES =====
+
+/**
+ * @brief Write the random state, spawn timers and every enemy
+ *          Positions and velocities are deltas within each kind
+ * 
+ * @param out Save state being written
+ */
+void EnemySystem::saveState(SaveWriter& out) const {
+    const ecs::Registry& reg = ecs::registry();
+
+    out.writeU32(mRandom);
+    for (int kind = 0; kind < static_cast<int>(EnemyKind::Count); kind++) {
+        out.writeFloat(mSpawnTimers[kind]);
+        out.writeVarint(mEnemies[kind].size());
+
+        sf::Vector2f lastPosition, lastVelocity;
+        for (const Enemy& enemy : mEnemies[kind]) {
+            const ecs::Animation& animation = reg.animations.get(enemy.entity);
+            out.writeDelta(reg.transforms.get(enemy.entity).position, lastPosition);
+            out.writeDelta(reg.velocities.get(enemy.entity).value, lastVelocity);
+            out.writeSigned(reg.healths.get(enemy.entity).hp);
+            out.writeSigned(enemy.lastCell);
+            out.writeFloat(enemy.timer);
+            out.writeVarint(animation.frame);
+            out.writeFloat(animation.elapsed);
+        }
+    }
+}
+
+/**
+ * @brief Read the enemies of a save state without touching the system
+ * 
+ * @param in Save state being read
+ * @param saved Receives the random state, timers and enemies, for applyState()
+ * @return false if the section is damaged
+ */
+bool EnemySystem::parseState(SaveReader& in, SavedState& saved) {
+    const int kinds = static_cast<int>(EnemyKind::Count);
+
+    saved.random = in.readU32();
+    for (int kind = 0; kind < kinds; kind++) {
+        saved.spawnTimers[kind] = in.readFloat();
+        saved.enemies[kind].resize(in.readCount(CAPACITY));
+
+        sf::Vector2f lastPosition, lastVelocity;
+        for (SavedEnemy& enemy : saved.enemies[kind]) {
+            enemy.position = in.readDelta(lastPosition);
+            enemy.velocity = in.readDelta(lastVelocity);
+            enemy.hp = static_cast<int>(in.readSigned());
+            enemy.lastCell = static_cast<int>(in.readSigned());
+            enemy.timer = in.readFloat();
+            enemy.frame = static_cast<int>(in.readVarint());
+            enemy.elapsed = in.readFloat();
+
+            if (enemy.frame < 0 || enemy.frame >= ENEMY_DEFS[kind].clip->count) {
+                in.fail();
+            }
+        }
+    }
+    return in.ok() && saved.random != 0;
+}
+
+/**
+ * @brief Replace every enemy with ones parseState() read
+ * 
+ * @param saved Output of a successful parseState()
+ */
+void EnemySystem::applyState(const SavedState& saved) {
+    clear();
+    ecs::Registry& reg = ecs::registry();
+    mRandom = saved.random;
+    for (int kind = 0; kind < static_cast<int>(EnemyKind::Count); kind++) {
+        mSpawnTimers[kind] = saved.spawnTimers[kind];
+
+        for (const SavedEnemy& s : saved.enemies[kind]) {
+            Enemy& enemy = create(static_cast<EnemyKind>(kind), s.position, s.velocity);
+            enemy.lastCell = s.lastCell;
+            enemy.timer = s.timer;
+            reg.healths.get(enemy.entity).hp = s.hp;
+
+            ecs::Animation& animation = reg.animations.get(enemy.entity);
+            animation.frame = s.frame;
+            animation.elapsed = s.elapsed;
+            reg.sprites.get(enemy.entity).rect = animation.table[s.frame].rect();
+        }
+    }
+}
+
+/**
+ * @brief Feed the random state, spawn timers and every enemy into the
+ *          tick checksum
+ * 
+ * @param sum Checksum of the current tick
+ */
+void EnemySystem::hashState(StateChecksum& sum) const {
+    static const char* const KIND_NAMES[] = {"flea", "spider", "scorpion"};
+    static_assert(sizeof(KIND_NAMES) / sizeof(KIND_NAMES[0]) == static_cast<std::size_t>(EnemyKind::Count),
+                  "One name per EnemyKind");
+    const ecs::Registry& reg = ecs::registry();
+
+    sum.beginEntity("enemy-spawner", 0);
+    sum.add(mRandom);
+    for (int kind = 0; kind < static_cast<int>(EnemyKind::Count); kind++) {
+        sum.addFloat(mSpawnTimers[kind]);
+    }
+
+    for (int kind = 0; kind < static_cast<int>(EnemyKind::Count); kind++) {
+        for (std::size_t i = 0; i < mEnemies[kind].size(); i++) {
+            const Enemy& enemy = mEnemies[kind][i];
+            sum.beginEntity(KIND_NAMES[kind], static_cast<int>(i));
+            sum.addVector(reg.transforms.get(enemy.entity).position);
+            sum.addVector(reg.velocities.get(enemy.entity).value);
+            sum.addSigned(reg.healths.get(enemy.entity).hp);
+            sum.addSigned(enemy.lastCell);
+            sum.addFloat(enemy.timer);
+        }
+    }
+}
+
+// ===== RANDOM =====
+
+/**
+ * @brief xorshift32 - cheap and independent of rand()
+ */
+std::uint32_t EnemySystem::random() {
+    mRandom ^= mRandom << 13;
+    mRandom ^= mRandom >> 17;
+    mRandom ^= mRandom << 5;
+    return mRandom;
+}
+
+/**
+ * @brief Uniform float in [low, high)
+ */
+float EnemySystem::randomRange(float low, float high) {
+    return low + (random() & 0xFFFFFF) / 16777216.0f * (high - low);
+}
@@ -0,0 +1,330 @@
+/**
+ * @file    entity_registry.cpp
+ * @author  Balin Becker
+ * @brief   Entity registry and component systems
+ * @date    2025-12-09
+ */
+
+#include "../includes/entity_registry.h"
+#include "../includes/aabb_kernel.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_set>
+
+namespace ecs {
+
+/**
+ * @brief Readable name of a type tag (debug output only)
+ */
+const char* typeName(EntityType type) {
+    switch (type) {
+        case EntityType::Bullet:           return "Bullet";
+        case EntityType::CentipedeHead:    return "CentipedeHead";
+        case EntityType::CentipedeSegment: return "CentipedeSegment";
+        case EntityType::Flea:             return "Flea";
+        case EntityType::Spider:           return "Spider";
+        case EntityType::Scorpion:         return "Scorpion";
+        default:                           return "Default";
+    }
+}
+
+/**
+ * @brief Collision category of a type tag
+ */
+std::uint32_t layerOf(EntityType type) {
+    switch (type) {
+        case EntityType::Bullet:           return LAYER_BULLET;
+        case EntityType::CentipedeHead:    return LAYER_CENTIPEDE_HEAD;
+        case EntityType::CentipedeSegment: return LAYER_CENTIPEDE_SEGMENT;
+        case EntityType::Flea:
+        case EntityType::Spider:
+        case EntityType::Scorpion:         return LAYER_ENEMY;
+        default:                           return LAYER_DEFAULT;
+    }
+}
+
+/**
+ * @brief Look a name up in the intern table, adding it the first time
+ *          unordered_set never moves its elements, so the pointer stays valid
+ */
+const std::string* internName(const std::string& name) {
+    static std::unordered_set<std::string> names;
+    return &*names.insert(name).first;
+}
+
+/**
+ * @brief Shared registry
+ */
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+/**
+ * @brief Get a fresh entity id, reusing destroyed ones first
+ */
+Entity Registry::create() {
+    if (!freeIds.empty()) {
+        Entity e = freeIds.back();
+        freeIds.pop_back();
+        return e;
+    }
+    return nextId++;
+}
+
+/**
+ * @brief Remove every component of an entity and recycle its id
+ */
+void Registry::destroy(Entity e) {
+    if (colliders.has(e)) {
+        // Mirror the collider's swap-and-pop on the bounds arrays
+        std::size_t slot = colliders.slotOf(e);
+        aabbs.minX[slot] = aabbs.minX.back();
+        aabbs.minY[slot] = aabbs.minY.back();
+        aabbs.maxX[slot] = aabbs.maxX.back();
+        aabbs.maxY[slot] = aabbs.maxY.back();
+        aabbs.dirty[slot] = aabbs.dirty.back();
+        aabbs.minX.pop_back();
+        aabbs.minY.pop_back();
+        aabbs.maxX.pop_back();
+        aabbs.maxY.pop_back();
+        aabbs.dirty.pop_back();
+    }
+
+    transforms.remove(e);
+    sprites.remove(e);
+    colliders.remove(e);
+    healths.remove(e);
+    animations.remove(e);
+    velocities.remove(e);
+    freeIds.push_back(e);
+}
+
+/**
+ * @brief Add a collider and an (empty, dirty) bounds slot for it
+ *          The entity must already have a Transform and a Sprite
+ */
+void Registry::addCollider(Entity e, const Collider& collider) {
+    colliders.add(e, collider);
+    aabbs.minX.push_back(0.0f);
+    aabbs.minY.push_back(0.0f);
+    aabbs.maxX.push_back(0.0f);
+    aabbs.maxY.push_back(0.0f);
+    aabbs.dirty.push_back(0);
+    markBoundsDirty(e);
+}
+
+/**
+ * @brief Flag an entity's cached bounds for recomputation
+ *          Call after changing its position, scale, origin or rect size
+ */
+void Registry::markBoundsDirty(Entity e) {
+    if (!colliders.has(e)) {
+        return;
+    }
+
+    // A dirty slot holds an infinite box, so the batch kernel always
+    // reports it and query() falls back to the exact test. Already-dirty
+    // slots are left alone, so dynamic objects never write here from jobs.
+    std::size_t slot = colliders.slotOf(e);
+    if (aabbs.dirty[slot]) {
+        return;
+    }
+
+    const float inf = std::numeric_limits<float>::infinity();
+    aabbs.minX[slot] = -inf;
+    aabbs.minY[slot] = -inf;
+    aabbs.maxX[slot] = inf;
+    aabbs.maxY[slot] = inf;
+    aabbs.dirty[slot] = 1;
+}
+
+/**
+ * @brief Recompute every dirty bounds slot, except dynamic ones
+ *          Main thread only, while no jobs are running
+ */
+void Registry::refreshBounds() {
+    const Collider* collider = colliders.data();
+    for (std::size_t i = 0; i < colliders.size(); i++) {
+        if (!aabbs.dirty[i] || collider[i].dynamic) {
+            continue;
+        }
+
+        sf::FloatRect rect = bounds(colliders.entityAt(i));
+        aabbs.minX[i] = rect.left;
+        aabbs.minY[i] = rect.top;
+        aabbs.maxX[i] = rect.left + rect.width;
+        aabbs.maxY[i] = rect.top + rect.height;
+        aabbs.dirty[i] = 0;
+    }
+}
+
+/**
+ * @brief Bounds from the cache, or computed on the spot if dirty
+ *          Never writes, so it is safe from jobs
+ */
+sf::FloatRect Registry::cachedBounds(Entity e) const {
+    std::size_t slot = colliders.slotOf(e);
+    if (aabbs.dirty[slot]) {
+        return bounds(e);
+    }
+    return sf::FloatRect(aabbs.minX[slot], aabbs.minY[slot],
+                         aabbs.maxX[slot] - aabbs.minX[slot], aabbs.maxY[slot] - aabbs.minY[slot]);
+}
+
+/**
+ * @brief Every collider in the mask whose bounds overlap region
+ *          The SIMD kernel tests 8 cached boxes at a time; only hits are
+ *          checked against the layer mask (and recomputed if dirty).
+ *          The mask is checked before the dirty flag, so a query never
+ *          touches per-object state outside its layers.
+ *          Same overlap rule as sf::FloatRect::intersects (touching edges miss)
+ * @param out Receives the overlapping entities (not cleared first)
+ */
+void Registry::query(const sf::FloatRect& region, std::uint32_t mask, std::vector<Entity>& out) const {
+    const std::size_t count = colliders.size();
+    if (count == 0) {
+        return;
+    }
+
+    // One scratch buffer per thread, so jobs can query at the same time
+    thread_local std::vector<std::uint8_t> hitMasks;
+    hitMasks.resize(aabb::maskBytes(count));
+
+    aabb::overlapMasks(region.left, region.top, region.left + region.width, region.top + region.height,
+                       aabbs.minX.data(), aabbs.minY.data(), aabbs.maxX.data(), aabbs.maxY.data(),
+                       count, hitMasks.data());
+
+    const Collider* collider = colliders.data();
+    for (std::size_t byte = 0; byte < hitMasks.size(); byte++) {
+        unsigned bits = hitMasks[byte];
+        while (bits != 0) {
+            std::size_t i = byte * 8 + __builtin_ctz(bits);
+            bits &= bits - 1;
+
+            if ((collider[i].category & mask) == 0) {
+                continue;
+            }
+            if (aabbs.dirty[i] && !region.intersects(bounds(colliders.entityAt(i)))) {
+                continue;
+            }
+            out.push_back(colliders.entityAt(i));
+        }
+    }
+}
+
+/**
+ * @brief World-space bounds from Transform and Sprite
+ *          Same result as sf::Sprite::getGlobalBounds() for unrotated sprites
+ * @param e Entity with a Transform and a Sprite
+ */
+sf::FloatRect Registry::bounds(Entity e) const {
+    const Transform& t = transforms.get(e);
+    const sf::IntRect& rect = sprites.get(e).rect;
+
+    float x1 = t.position.x - t.origin.x * t.scale.x;
+    float y1 = t.position.y - t.origin.y * t.scale.y;
+    float x2 = x1 + rect.width * t.scale.x;
+    float y2 = y1 + rect.height * t.scale.y;
+
+    return sf::FloatRect(std::min(x1, x2), std::min(y1, y2), std::abs(x2 - x1), std::abs(y2 - y1));
+}
+
+/**
+ * @brief Movement system - position += velocity * dt
+ *          Works on a slice of the velocity array so it can be split into jobs
+ * @param begin First velocity slot
+ * @param end One past the last velocity slot
+ */
+void Registry::integrateVelocities(float dt, std::size_t begin, std::size_t end) {
+    const Velocity* velocity = velocities.data();
+    for (std::size_t i = begin; i < end; i++) {
+        Entity e = velocities.entityAt(i);
+        sf::Vector2f step = velocity[i].value * dt;
+        transforms.get(e).position += step;
+
+        // A pure translation moves the cached box by the same amount
+        if (colliders.has(e)) {
+            std::size_t slot = colliders.slotOf(e);
+            aabbs.minX[slot] += step.x;
+            aabbs.maxX[slot] += step.x;
+            aabbs.minY[slot] += step.y;
+            aabbs.maxY[slot] += step.y;
+        }
+    }
+}
+
+/**
+ * @brief Animation system - advance frame indices, write the sprite rect
+ *          only when the frame actually changes
+ */
+void Registry::updateAnimations(float dt) {
+    Animation* anim = animations.data();
+    for (std::size_t i = 0; i < animations.size(); i++) {
+        anim[i].elapsed += dt;
+
+        if (anim[i].elapsed >= anim[i].frameTime) {
+            anim[i].elapsed -= anim[i].frameTime;
+            anim[i].frame++;
+            if (anim[i].frame >= anim[i].frames) {
+                anim[i].frame = 0;
+            }
+
+            // Frames of a clip share one size, so the cached bounds stay valid
+            sprites.get(animations.entityAt(i)).rect = anim[i].table[anim[i].frame].rect();
+        }
+    }
+}
+
+/**
+ * @brief Render system - copy every sprite of one type into a snapshot
+ */
+void Registry::collectSprites(EntityType type, std::vector<SpriteInstance>& out) const {
+    const Collider* collider = colliders.data();
+    for (std::size_t i = 0; i < colliders.size(); i++) {
+        if (collider[i].type == type) {
+            out.push_back(spriteInstance(colliders.entityAt(i)));
+        }
+    }
+}
+
+/**
+ * @brief Render system with culling - copy the sprites of one type whose
+ *          bounds overlap the view
+ * @param candidates Entities near the view (e.g. from World's chunk lists);
+ *          ids destroyed since the list was built are skipped
+ * @return Candidates of this type that were outside the view
+ */
+std::size_t Registry::collectVisibleSprites(EntityType type, const std::vector<Entity>& candidates,
+                                            const sf::FloatRect& view, std::vector<SpriteInstance>& out) const {
+    std::size_t culled = 0;
+    for (Entity e : candidates) {
+        if (!colliders.has(e) || colliders.get(e).type != type) {
+            continue;
+        }
+
+        if (cachedBounds(e).intersects(view)) {
+            out.push_back(spriteInstance(e));
+        } else {
+            culled++;
+        }
+    }
+    return culled;
+}
+
+/**
+ * @brief Transform and atlas rect of one entity, as the render thread wants it
+ */
+SpriteInstance Registry::spriteInstance(Entity e) const {
+    const Transform& t = transforms.get(e);
+
+    SpriteInstance instance;
+    instance.position = t.position;
+    instance.origin = t.origin;
+    instance.scale = t.scale;
+    instance.textureRect = sprites.get(e).rect;
+    return instance;
+}
+
+} // namespace ecs
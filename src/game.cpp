@@ -9,18 +9,40 @@
 
 #include "../includes/game.h"
 #include "../includes/errorHandler.h"
+#include "../includes/FrameLimiter.h"
+#include <algorithm>
+#include <cmath>
+#include <chrono>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+
+// Largest sprite extent past its position, pads the culling chunk lookup
+static const float CULL_MARGIN = 64.0f;
+
+// Each session (new game or loaded state) gets a new id so the render thread drops the old field
+static std::uint32_t sessionCounter = 0;
+
+// Save file signature, followed by the format version
+static const char SAVE_MAGIC[4] = {'C', 'S', 'A', 'V'};
+
+// Most bullets / chains a save state may hold
+static const std::size_t SAVE_MAX_BULLETS = 4096;
+static const std::size_t SAVE_MAX_CHAINS = 256;
 
 /**
  * @brief Constructor - initialize game systems
- * Setup window reference, screen manager, and UI text.
+ * Setup window reference, screen manager, and atlas texture.
+ * The HUD text is drawn by the RenderThread.
  * @param win Reference to render window
  * @param screenMngr Reference to ScreenManager
+ * @param debugOptions Command line switches (stress mode)
  */
-Game::Game(sf::RenderWindow &win, ScreenManager &screenMngr)
+Game::Game(sf::RenderWindow &win, ScreenManager &screenMngr, const DebugOptions &debugOptions)
     : window(win),
       screenManager(screenMngr),
+      options(debugOptions),
       currentState(GameState::PLAYING),
       isGameOver(false),
       isPaused(false),
@@ -28,34 +50,21 @@ Game::Game(sf::RenderWindow &win, ScreenManager &screenMngr)
       lives(3),
       level(1),
       player(nullptr),
-      centipede(nullptr),
-      grid(nullptr) {
+      respawnTimer(0),
+      enemies(nullptr),
+      world(nullptr),
+      mushroomSequence(0),
+      mushroomSession(0),
+      grid(nullptr),
+      lastInputTime(0),
+      rewinding(false),
+      tickCount(0) {
     std::cout << "[Game] Constructor called" << std::endl;
 
-    background.setSize(sf::Vector2f(window.getSize().x, window.getSize().y));
-    background.setPosition(0, 0);
-    background.setFillColor(sf::Color::Black);
-
-    sf::Font &font = screenManager.getFont();
-
-    scoreText.setFont(font);
-    scoreText.setCharacterSize(20);
-    scoreText.setFillColor(sf::Color::Green);
-    scoreText.setPosition(10, 10);
-
-    livesText.setFont(font);
-    livesText.setCharacterSize(20);
-    livesText.setFillColor(sf::Color::Green);
-    livesText.setPosition(window.getSize().x - 200, 10);
-
-    levelText.setFont(font);
-    levelText.setCharacterSize(20);
-    levelText.setFillColor(sf::Color::Green);
-    levelText.setPosition(window.getSize().x / 2 - 50, 10);
-
     if (!loadTextures()) {
         logError("Game", "Failed to load atlas texture");
     }
+    audio.load();
 
     std::cout << "[Game] Constructor completed" << std::endl;
 }
@@ -77,9 +86,18 @@ void Game::initialize() {
     std::cout << "[Game] initialize() called" << std::endl;
 
     if (grid == nullptr) {
-        grid = new Grid(sf::FloatRect(125, 80, 950, 720), 16);
-        std::cout << "[Game] Grid created: 950x720 at (125,80)" << std::endl;
+        float width = FIELD_WIDTH * options.worldWidth;
+        float height = FIELD_HEIGHT * options.worldHeight;
+        grid = new Grid(sf::FloatRect(125, 80, width, height), 16);
+        std::cout << "[Game] Grid created: " << width << "x" << height << " at (125,80)" << std::endl;
+    }
+
+    if (world == nullptr) {
+        world = new World(*grid);
+        std::cout << "[Game] World: " << world->getColumns() << "x" << world->getRows()
+                  << " cells in " << world->getChunkCount() << " chunks" << std::endl;
     }
+    camera = window.getDefaultView();
 
     SettingsScreen *settings =
         (SettingsScreen *)screenManager.getScreen(GameState::SETTINGS);
@@ -90,6 +108,19 @@ void Game::initialize() {
         std::cout << "[Game] Settings: Lives=" << lives << ", Level=" << level << std::endl;
     }
 
+    mushroomSession = ++sessionCounter;
+    mushroomSequence = 0;
+    mushroomLog.clear();
+
+    tickCount = 0;
+    if (!options.checksumFile.empty()) {
+        if (checksum.openLog(options.checksumFile)) {
+            std::cout << "[Game] Logging state checksums to " << options.checksumFile << std::endl;
+        } else {
+            logError("Game", "Could not write checksum log " + options.checksumFile);
+        }
+    }
+
     score = 0;
     isGameOver = false;
     isPaused = false;
@@ -97,9 +128,16 @@ void Game::initialize() {
 
     player = new sf::RectangleShape();
     Player::startPlayer(*player, texture);
+    respawnTimer = 0;
+
+    input.start();
+    audio.start();
 
-    //centipede = new Centipede(texture, 5, sf::Vector2f(200, 100), sf::Vector2i(2, 2));
-    //std::cout << "[Game] Centipede created" << std::endl;
+    if (enemies == nullptr) {
+        enemies = new EnemySystem(texture);
+    }
+
+    spawnCentipede();
 
     generateMushrooms();
 
@@ -120,8 +158,14 @@ void Game::handleInput(const sf::Event &event) {
             event.key.code == sf::Keyboard::Escape) {
             isPaused = !isPaused;
             currentState = isPaused ? GameState::PAUSED : GameState::PLAYING;
+            audio.setMusicPaused(isPaused);
             std::cout << "[Game] " << (isPaused ? "PAUSED" : "RESUMED") << std::endl;
         }
+        if (event.key.code == sf::Keyboard::BackSpace && options.rewind) {
+            rewinding = true;
+        }
+    } else if (event.type == sf::Event::KeyReleased && event.key.code == sf::Keyboard::BackSpace) {
+        rewinding = false;
     }
 }
 
@@ -129,170 +173,437 @@ void Game::handleInput(const sf::Event &event) {
  * @brief Update - game logic each frame
  * Updates player, bullets, mushrooms, centipede.
  * Handles collisions between all objects.
+ *
+ * Job graph (arrows = "must finish before"):
+ * ```
+ * movement system
+ *        │
+ *        ├─> centipede chains (in parallel) ─> animation system
+ *        │                                          │
+ *        └──────────────────────────────────────────┴─> collision broad-phase
+ * ```
+ * Everything that creates or deletes objects (shooting, removals,
+ * applying hits) stays on the main thread, before or after the graph,
+ * so no job ever sees a component array change size.
  * @param dt Delta time since last frame
  */
 void Game::update(float dt) {
     if (isPaused || isGameOver)
         return;
 
+    // Rewind: one captured tick back per frame, nothing simulated
+    if (rewinding) {
+        if (rewind.stepBack(rewindState)) {
+            loadState(rewindState, true);
+        }
+        input.discard();
+        return;
+    }
+
+    respawnTimer = std::max(0.0f, respawnTimer - dt);
+
+    // One immutable view of the buttons for the whole tick
+    const InputSnapshot buttons = input.beginTick();
+    lastInputTime = buttons.newestChange;
+
     // Update player movement
     if (player) {
-        Player::movePlayer(*player, dt, grid->GetRegion());
+        Player::movePlayer(*player, dt, grid->GetRegion(), buttons);
     }
+    updateCamera();
 
-    // Update bullets
-    Bullet::shoot(player->getPosition(), dt, texture);
-    
-    for (int i = (int)Bullet::bullets.size() - 1; i >= 0; i--) {
-        Bullet::bullets[i]->update(dt);
-        
-        if (!Bullet::bullets[i]->isAlive()) {
-            delete Bullet::bullets[i];
-            Bullet::bullets.erase(Bullet::bullets.begin() + i);
-        }
-    }
-    //std::cout << " NOW!!!!" << '\n';
-for (int i = (int)Bullet::bullets.size() - 1; i >= 0; i--) {
-        Bullet* bullet = Bullet::bullets[i];
-        bullet->update(dt);
-        if (!(bullet->isAlive())) {
-        sf::Vector2f pos = bullet->getPosition();       // position as float
-        sf::Vector2i intPos(static_cast<int>(pos.x), static_cast<int>(pos.y)); // convert to int
-            std::cout << "The x value for the bullet = " << intPos.x
-                << " and the y value for the bullet = " << intPos.y << '\n';
-        delete bullet;
-        Bullet::bullets.erase(Bullet::bullets.begin() + i);
-        std::cout << "[Game] Bullet removed (off-screen)" << std::endl;
-                        }
-    }
-    
+    // Only chunks near the camera are unpacked and simulated
+    world->stream(getCameraRect());
 
-    
-    // Update mushrooms
-    for (auto mushroom : mushrooms) {
-        if (mushroom) {
-            mushroom->update();
-        }
+    // Spawn bullets (adds entities, so not in a job)
+    if (Bullet::shoot(player->getPosition(), dt, texture, buttons)) {
+        audio.trigger(SoundId::Shoot);
+        particles.emit(ParticleEffect::MuzzleFlash, player->getPosition() + sf::Vector2f(16, 0));
     }
 
-    // Remove destroyed mushrooms
-    for (int i = (int)mushrooms.size() - 1; i >= 0; i--) {
-        if (mushrooms[i]->isDestroyed()) {
-            delete mushrooms[i];
-            mushrooms.erase(mushrooms.begin() + i);
+    // Enemies: spawn (adds entities), then steer and change mushrooms.
+    // Stress mode keeps the population topped up instead of timed spawns.
+    if (options.stress) {
+        int kind = 0;
+        while (enemies->count() < STRESS_ENEMIES &&
+               enemies->spawn(static_cast<EnemyKind>(kind), grid->GetRegion())) {
+            kind = (kind + 1) % static_cast<int>(EnemyKind::Count);
         }
+    } else {
+        enemies->spawnTimed(dt, grid->GetRegion());
     }
-
-    // Update centipede
-    
-    if (centipede) {
-        centipede->move(dt, *grid);
-        centipede->update(dt);
+    enemies->update(dt, *world, grid->GetRegion(), dirtyMushrooms);
+
+    std::vector<Bullet*> &bullets = Bullet::bullets;
+    ecs::Registry &reg = ecs::registry();
+
+    // Bring cached bounds up to date before any job queries them
+    reg.refreshBounds();
+
+    // Movement system over the packed Velocity array
+    JobSystem::Job *bulletsJob = jobs.parallelFor(reg.velocities.size(), 256,
+        [&reg, dt](std::size_t begin, std::size_t end) {
+            reg.integrateVelocities(dt, begin, end);
+        });
+
+    // Centipede movement, one job per chain. A chain only queries the
+    // mushroom tiles and only writes its own segments, so chains run in
+    // parallel once the bullets have moved. Chains whose head is in a
+    // packed chunk are frozen until the camera comes back.
+    JobSystem::Job *animationJob = jobs.createJob([&reg, dt]() {
+        reg.updateAnimations(dt);
+    });
+    for (Centipede *chain : centipedes) {
+        if (!world->isActiveAt(chain->getPosition())) continue;
+
+        JobSystem::Job *chainJob = jobs.createJob([this, chain, dt]() {
+            chain->move(dt, *grid, *world);
+        });
+        jobs.addDependency(chainJob, bulletsJob);
+
+        // Animation system writes the sprite rects the chains read
+        jobs.addDependency(animationJob, chainJob);
     }
 
-    // Handle collisions
+    // Collision broad-phase: first mushroom cell (tile lookup) and first
+    // centipede segment or enemy (SIMD batch test in Registry::query) per
+    // bullet. Waits for the animation job, which waits for every chain.
+    bulletMushroomHits.assign(bullets.size(), -1);
+    bulletTargetHits.assign(bullets.size(), ecs::NO_ENTITY);
+    JobSystem::Job *broadPhaseJob = jobs.parallelFor(bullets.size(), 16,
+        [this, &bullets, &reg](std::size_t begin, std::size_t end) {
+            std::vector<ecs::Entity> hits;
+            for (std::size_t b = begin; b < end; b++) {
+                if (!bullets[b]->isAlive()) continue;
+
+                sf::FloatRect bounds = bullets[b]->getBounds();
+                bulletMushroomHits[b] = world->firstHit(bounds);
+
+                hits.clear();
+                reg.query(bounds, ecs::LAYER_CENTIPEDE | ecs::LAYER_ENEMY, hits);
+                if (!hits.empty()) {
+                    bulletTargetHits[b] = hits.front();
+                }
+            }
+        });
+    jobs.addDependency(broadPhaseJob, bulletsJob);
+    jobs.addDependency(broadPhaseJob, animationJob);
+
+    jobs.run();
+
+    // Handle collisions (uses the broad-phase results)
     handleCollisions();
 
-    updateUI();
+    // Refresh / remove only the mushrooms that were hit
+    processMushroomEvents();
+
+    // Effects spawned this tick move from the next one
+    particles.update(dt);
+
+    // Remove killed enemies and those that left the field
+    enemies->removeDead();
+    removeDeadChains();
+
+    // Remove dead bullets
+    for (int i = (int)bullets.size() - 1; i >= 0; i--) {
+        if (!bullets[i]->isAlive()) {
+            delete bullets[i];
+            bullets.erase(bullets.begin() + i);
+        }
+    }
+
+    // Per-chunk entity lists, now that nothing moves or dies this tick
+    world->indexEntities(reg);
+
     checkGameOver();
 
+    // One batch of sounds per tick
+    audio.endTick();
+
+    if (options.rewind && rewind.wantsCapture()) {
+        std::uint64_t start = FrameLimiter::nowMicros();
+        saveState(rewindState);
+        rewind.capture(rewindState, FrameLimiter::nowMicros() - start);
+    }
+
+    hashState(dt, buttons);
+
     static int frameCount = 0;
     if (++frameCount % 60 == 0) {
         debugPrint();
+        profiler().print();
+        if (options.rewind) {
+            rewind.report(options.frameRate);
+        }
     }
 }
 
 /**
  * @brief Handle all collision detection
- * Checks bullet-mushroom, bullet-centipede, and player-centipede.
+ * Checks bullet-mushroom, bullet-centipede/enemy, and player-centipede/enemy.
+ * Bullet pairs come from the broad-phase job in update(); the player
+ * test uses the same batch query. Stress mode makes the player
+ * invulnerable so the run does not end.
  */
 void Game::handleCollisions() {
+    ecs::Registry &reg = ecs::registry();
+
     // Bullet vs Mushroom
     for (int b = (int)Bullet::bullets.size() - 1; b >= 0; b--) {
-        if (!Bullet::bullets[b]->isAlive()) continue;
-        
-        sf::FloatRect bulletBounds = Bullet::bullets[b]->getSprite().getGlobalBounds();
-        
-        for (int m = (int)mushrooms.size() - 1; m >= 0; m--) {
-            sf::Vector2f mushPos = mushrooms[m]->getPosition();
-            sf::FloatRect mushBounds(mushPos.x - 16, mushPos.y - 16, 32, 32);
-            
-            if (bulletBounds.intersects(mushBounds)) {
-                mushrooms[m]->hit(1);
-                Bullet::bullets[b]->kill();
-                score += 5;
-                std::cout << "[Game] Bullet hit mushroom! Score: " << score << std::endl;
-                break;
+        int cell = bulletMushroomHits[b];
+        if (cell < 0 || !Bullet::bullets[b]->isAlive()) continue;
+
+        world->hit(cell, 1);
+        dirtyMushrooms.push_back(cell);
+        Bullet::bullets[b]->kill();
+        audio.trigger(SoundId::MushroomHit);
+        particles.emit(ParticleEffect::MushroomChips, Bullet::bullets[b]->getPosition());
+        score += 5;
+        std::cout << "[Game] Bullet hit mushroom! Score: " << score << std::endl;
+    }
+
+    // Bullet vs Centipede / Enemy
+    for (int b = (int)Bullet::bullets.size() - 1; b >= 0; b--) {
+        ecs::Entity part = bulletTargetHits[b];
+        if (part == ecs::NO_ENTITY || !Bullet::bullets[b]->isAlive()) continue;
+        // An earlier bullet may already have destroyed the target's entity
+        if (!reg.colliders.has(part)) continue;
+
+        if (EnemySystem::isEnemy(reg.colliders.get(part).type)) {
+            // An earlier bullet may already have killed it
+            if (!enemies->isAlive(part)) continue;
+
+            Bullet::bullets[b]->kill();
+            audio.trigger(SoundId::EnemyHit);
+            particles.emit(ParticleEffect::EnemyExplosion, Bullet::bullets[b]->getPosition());
+            score += enemies->hit(part);
+            continue;
+        }
+
+        for (std::size_t c = 0; c < centipedes.size(); c++) {
+            if (!centipedes[c]->contains(part)) continue;
+
+            Bullet::bullets[b]->kill();
+            score += 100;
+            audio.trigger(SoundId::CentipedeHit);
+            particles.emit(ParticleEffect::SegmentExplosion, Bullet::bullets[b]->getPosition());
+            std::cout << "[Game] Bullet hit centipede! Score: " << score << std::endl;
+
+            // A hit in the middle splits off the segments behind it
+            Centipede *rear = centipedes[c]->hit(reg.colliders.get(part).object);
+            if (rear) {
+                centipedes.push_back(rear);
             }
+            break;
         }
     }
 
-    // Bullet vs Centipede
-    if (centipede) {
-        for (int b = (int)Bullet::bullets.size() - 1; b >= 0; b--) {
-            if (!Bullet::bullets[b]->isAlive()) continue;
-            
-            sf::FloatRect bulletBounds = Bullet::bullets[b]->getSprite().getGlobalBounds();
-            sf::Vector2f centipedePos = centipede->getPosition();
-            sf::FloatRect centipedeBounds(centipedePos.x , centipedePos.y , 32, 32);
-            
-            if (bulletBounds.intersects(centipedeBounds)) {
-                Bullet::bullets[b]->kill();
-                score += 100;
-                std::cout << "[Game] Bullet hit centipede! Score: " << score << std::endl;
-                Bullet::bullets[b]->kill();
-                centipede->hit();
+    // Player vs Centipede / Enemy: one life per hit, then the player
+    // respawns at the start and is untouchable for RESPAWN_SECONDS.
+    // Enemies that touched the player die with it.
+    if (player && !options.stress && respawnTimer <= 0) {
+        std::vector<ecs::Entity> touching;
+        reg.query(player->getGlobalBounds(), ecs::LAYER_CENTIPEDE | ecs::LAYER_ENEMY, touching);
+
+        if (!touching.empty()) {
+            for (ecs::Entity e : touching) {
+                if (EnemySystem::isEnemy(reg.colliders.get(e).type) && enemies->isAlive(e)) {
+                    enemies->kill(e);
+                    particles.emit(ParticleEffect::EnemyExplosion, reg.transforms.get(e).position);
+                }
             }
+
+            lives--;
+            audio.trigger(SoundId::PlayerHit);
+            particles.emit(ParticleEffect::EnemyExplosion, player->getPosition());
+            Player::resetPlayer(*player);
+            respawnTimer = RESPAWN_SECONDS;
+            std::cout << "[Game] Player hit! Lives: " << lives << std::endl;
         }
     }
+}
 
-    // Player vs Centipede
-    if (centipede && player) {
-        sf::FloatRect playerBounds = player->getGlobalBounds();
-        sf::Vector2f centipedePos = centipede->getPosition();
-        sf::FloatRect centipedeBounds(centipedePos.x - 16, centipedePos.y - 16, 32, 32);
-        
-        if (playerBounds.intersects(centipedeBounds)) {
-            lives--;
-            std::cout << "[Game] Player hit by centipede! Lives: " << lives << std::endl;
+/**
+ * @brief Start a new chain on the top row
+ * The head sits on a grid cell, so it moves by the flow table.
+ */
+void Game::spawnCentipede() {
+    sf::FloatRect region = grid->GetRegion();
+    float cell = static_cast<float>(grid->GetCellSize());
+    sf::Vector2f head(region.left + CENTIPEDE_LENGTH * cell, region.top);
+
+    centipedes.push_back(new Centipede(texture, CENTIPEDE_LENGTH, head, sf::Vector2i(2, 2)));
+    std::cout << "[Game] Centipede created (" << CENTIPEDE_LENGTH << " segments)" << std::endl;
+}
+
+/**
+ * @brief Delete chains whose last segment was shot
+ * Clearing every chain finishes the level and starts the next wave.
+ */
+void Game::removeDeadChains() {
+    bool removed = false;
+    for (int i = (int)centipedes.size() - 1; i >= 0; i--) {
+        if (centipedes[i]->empty()) {
+            delete centipedes[i];
+            centipedes.erase(centipedes.begin() + i);
+            removed = true;
         }
     }
+
+    if (removed && centipedes.empty()) {
+        level++;
+        std::cout << "[Game] Centipede cleared! Level: " << level << std::endl;
+        spawnCentipede();
+    }
 }
 
 /**
- * @brief Render - draw all game objects to window
- * Order: background, mushrooms, centipede, bullets, player, UI.
+ * @brief Apply this frame's mushroom damage events
+ * A mushroom's look only changes when it is hit, so only damaged cells
+ * are sent on to the render thread's layer - the rest of the field
+ * costs nothing per frame.
  */
-void Game::render() {
-    window.draw(background);
+void Game::processMushroomEvents() {
+    for (int cell : dirtyMushrooms) {
+        logMushroom(cell);
+    }
+    dirtyMushrooms.clear();
+}
 
-    for (auto mushroom : mushrooms) {
-        if (mushroom) window.draw(*mushroom);
+/**
+ * @brief Record a cell's new look (or removal, if it is now empty)
+ * The render thread redraws only these in its mushroom layer.
+ */
+void Game::logMushroom(int cell) {
+    MushroomChange change;
+    change.sequence = ++mushroomSequence;
+    change.cell = static_cast<std::uint32_t>(cell);
+    change.chunk = static_cast<std::uint32_t>(world->chunkOfCell(cell));
+    change.removed = world->isEmpty(cell);
+    if (!change.removed) {
+        change.sprite = world->spriteAt(cell);
     }
+    mushroomLog.push_back(change);
+}
 
-    for (Bullet* bullet : Bullet::bullets)
-    {
-        if (bullet )
-        {
-            window.draw(bullet->getSprite());
-        }
+/**
+ * @brief Keep the player on screen when the world is larger than the window
+ * Each axis scrolls only if the world is larger than the window on it,
+ * and never shows past the world's right or bottom edge; a world that
+ * fits the window keeps the default view.
+ */
+void Game::updateCamera() {
+    sf::Vector2f size = camera.getSize();
+    sf::FloatRect region = grid->GetRegion();
+    float right = region.left + region.width;
+    float bottom = region.top + region.height;
+
+    float centerX = size.x / 2;
+    float centerY = size.y / 2;
+    if (player && right > size.x) {
+        centerX = std::max(size.x / 2, std::min(right - size.x / 2, player->getPosition().x));
+    }
+    if (player && bottom > size.y) {
+        centerY = std::max(size.y / 2, std::min(bottom - size.y / 2, player->getPosition().y));
     }
+    camera.setCenter(centerX, centerY);
+}
+
+/**
+ * @brief Camera rectangle in world coordinates
+ */
+sf::FloatRect Game::getCameraRect() const {
+    sf::Vector2f size = camera.getSize();
+    sf::Vector2f center = camera.getCenter();
+    return sf::FloatRect(center.x - size.x / 2, center.y - size.y / 2, size.x, size.y);
+}
 
-    if (centipede) {
-        window.draw(*centipede);
+/**
+ * @brief Build the render snapshot for this frame
+ * Copies the sprite of every visible moving object into the snapshot,
+ * in draw order: centipede, enemies, bullets, player, then the particles
+ * inside the view. Candidates come from the
+ * world's chunk lists around the camera, then each one's bounds are
+ * tested against the view; drawn and culled counts go to the profiler.
+ * Mushrooms live in the render thread's chunk layers, so only the
+ * changes it has not acknowledged are sent, plus the camera and chunk
+ * layout to place them.
+ * The RenderThread draws it after the snapshot is published, so nothing
+ * here may keep pointers into game objects.
+ * @param snapshot Empty snapshot from RenderThread::beginFrame()
+ * @param ack Last mushroom change the render thread has applied
+ */
+void Game::buildSnapshot(FrameSnapshot &snapshot, const MushroomAck &ack) {
+    snapshot.atlas = &texture;
+    snapshot.view = camera;
+    if (world) {
+        snapshot.worldOrigin = world->getOrigin();
+        snapshot.chunkPixels = world->getChunkPixels();
+        snapshot.chunkColumns = world->getChunkColumns();
     }
 
-    for (auto bullet : Bullet::bullets) {
-        window.draw(bullet->getSprite());
+    // Forget changes the layer already has, send the rest
+    std::uint64_t applied = (ack.session == mushroomSession) ? ack.sequence : 0;
+    if (applied > 0) {
+        std::size_t keepFrom = 0;
+        while (keepFrom < mushroomLog.size() && mushroomLog[keepFrom].sequence <= applied) {
+            keepFrom++;
+        }
+        mushroomLog.erase(mushroomLog.begin(), mushroomLog.begin() + keepFrom);
+    }
+    snapshot.mushroomSession = mushroomSession;
+    snapshot.mushroomChanges = mushroomLog;
+
+    // Culling: only entities listed in chunks near the view are tested
+    const ecs::Registry &reg = ecs::registry();
+    sf::FloatRect view = getCameraRect();
+    visibleCandidates.clear();
+    if (world) {
+        sf::FloatRect padded(view.left - CULL_MARGIN, view.top - CULL_MARGIN,
+                             view.width + 2 * CULL_MARGIN, view.height + 2 * CULL_MARGIN);
+        world->collectEntities(padded, visibleCandidates);
     }
 
-    if (player) {
-        window.draw(*player);
+    // Render system, one pass per type to keep the draw order
+    std::size_t culled = 0;
+    culled += reg.collectVisibleSprites(ecs::EntityType::CentipedeSegment, visibleCandidates, view, snapshot.sprites);
+    culled += reg.collectVisibleSprites(ecs::EntityType::CentipedeHead, visibleCandidates, view, snapshot.sprites);
+    culled += reg.collectVisibleSprites(ecs::EntityType::Flea, visibleCandidates, view, snapshot.sprites);
+    culled += reg.collectVisibleSprites(ecs::EntityType::Spider, visibleCandidates, view, snapshot.sprites);
+    culled += reg.collectVisibleSprites(ecs::EntityType::Scorpion, visibleCandidates, view, snapshot.sprites);
+    culled += reg.collectVisibleSprites(ecs::EntityType::Bullet, visibleCandidates, view, snapshot.sprites);
+
+    // Colliders in no candidate chunk were never tested, and are culled too
+    std::size_t drawn = snapshot.sprites.size();
+    culled += reg.colliders.size() - std::min(drawn + culled, reg.colliders.size());
+
+    // Blinks while respawning
+    bool playerShown = respawnTimer <= 0 || std::fmod(respawnTimer, 0.2f) >= 0.1f;
+
+    if (player && playerShown && player->getGlobalBounds().intersects(view)) {
+        // The player is a textured rectangle: scale its atlas cell up to its size
+        SpriteInstance instance;
+        instance.position = player->getPosition();
+        instance.origin = player->getOrigin();
+        instance.textureRect = player->getTextureRect();
+        instance.scale = sf::Vector2f(player->getSize().x / instance.textureRect.width,
+                                      player->getSize().y / instance.textureRect.height);
+        snapshot.sprites.push_back(instance);
+        drawn++;
+    } else if (player && playerShown) {
+        culled++;
     }
 
-    window.draw(scoreText);
-    window.draw(livesText);
-    window.draw(levelText);
+    profiler().record("cull.drawn", static_cast<double>(drawn));
+    profiler().record("cull.culled", static_cast<double>(culled));
+
+    particles.writeInstances(snapshot.particles, view);
+    profiler().record("particles.live", static_cast<double>(particles.size()));
+
+    snapshot.score = score;
+    snapshot.lives = lives;
+    snapshot.level = level;
+    snapshot.inputTime = lastInputTime;
 }
 
 /**
@@ -321,6 +632,12 @@ void Game::setState(GameState newState) {
 void Game::setPaused(bool paused) {
     isPaused = paused;
     currentState = paused ? GameState::PAUSED : GameState::PLAYING;
+    audio.setMusicPaused(paused);
+
+    // Keys pressed in the pause menu must not reach the first tick back
+    if (!paused) {
+        input.discard();
+    }
     std::cout << "[Game] Game " << (paused ? "paused" : "resumed") << std::endl;
 }
 
@@ -339,20 +656,31 @@ bool Game::getPaused() const {
 void Game::cleanup() {
     std::cout << "[Game] cleanup() called" << std::endl;
 
+    input.stop();
+    audio.stop();
+    particles.clear();
+    rewind.clear();
+
     if (player != nullptr) {
         delete player;
         player = nullptr;
     }
 
-    if (centipede != nullptr) {
+    for (Centipede *centipede : centipedes) {
         delete centipede;
-        centipede = nullptr;
     }
+    centipedes.clear();
 
-    for (auto mushroom : mushrooms) {
-        if (mushroom != nullptr) delete mushroom;
+    if (enemies != nullptr) {
+        delete enemies;
+        enemies = nullptr;
     }
-    mushrooms.clear();
+
+    if (world != nullptr) {
+        delete world;
+        world = nullptr;
+    }
+    dirtyMushrooms.clear();
 
     for (auto bullet : Bullet::bullets) {
         if (bullet != nullptr) {
@@ -385,30 +713,34 @@ bool Game::loadTextures() {
 
 /**
  * @brief Generate random mushroom obstacles
- * Spawns at random positions within grid bounds.
- * Count = 10 + (level * 2). Scaled 3x3.
+ * Fills random empty cells, keeping the top 50px and bottom 250px of
+ * the grid clear. Count = 10 + (level * 2) per default-sized field.
  */
 void Game::generateMushrooms() {
-    if (grid == nullptr) {
+    if (grid == nullptr || world == nullptr) {
         std::cerr << "[Game] ERROR: Grid not initialized!" << std::endl;
         return;
     }
-    int mushroomCount = 10 + (level * 2);
+    int mushroomCount = (10 + (level * 2)) * static_cast<int>(options.worldWidth * options.worldHeight);
     std::cout << "[Game] Generating " << mushroomCount << " mushrooms" << std::endl;
 
-    for (int i = 0; i < mushroomCount; i++) {
-        float randomX = rand() % (int)grid->GetRegion().width + grid->GetRegion().left;
-        float randomY = rand() % (int)(grid->GetRegion().height - 250) + grid->GetRegion().top + 50;
+    int cellSize = grid->GetCellSize();
+    int firstRow = 50 / cellSize;
+    int lastRow = world->getRows() - 250 / cellSize;
+    if (lastRow <= firstRow) {
+        lastRow = world->getRows();
+    }
 
-        Mushroom *mushroom = new Mushroom(
-            texture,
-            sf::IntRect(64, 64, 32, 32),
-            sf::Vector2f(randomX, randomY),
-            4,
-            false);
+    int placed = 0;
+    for (int attempt = 0; placed < mushroomCount && attempt < mushroomCount * 10; attempt++) {
+        int column = rand() % world->getColumns();
+        int row = firstRow + rand() % (lastRow - firstRow);
 
-        mushroom->setScale(sf::Vector2i(3, 3));
-        mushrooms.push_back(mushroom);
+        int cell = world->cellIndex(column, row);
+        if (world->place(cell, MAXHEALTH, false)) {
+            logMushroom(cell);
+            placed++;
+        }
     }
 }
 
@@ -463,16 +795,6 @@ void Game::savePlayerScore(const std::string &playerName) {
     }
 }
 
-/**
- * @brief Update UI text elements
- * Updates score, lives, and level display.
- */
-void Game::updateUI() {
-    scoreText.setString("Score: " + std::to_string(score));
-    livesText.setString("Lives: " + std::to_string(lives));
-    levelText.setString("Level: " + std::to_string(level));
-}
-
 /**
  * @brief Debug print game state
  * Logs score, lives, level, and object counts.
@@ -480,5 +802,283 @@ void Game::updateUI() {
 void Game::debugPrint() const {
     std::cout << "[Game] Score: " << score << " | Lives: " << lives
               << " | Level: " << level << " | Bullets: " << Bullet::bullets.size()
-              << " | Mushrooms: " << mushrooms.size() << std::endl;
+              << " | Enemies: " << (enemies ? enemies->count() : 0)
+              << " | Mushrooms: " << (world ? world->count() : 0)
+              << " | Packed chunk bytes: " << (world ? world->packedBytes() : 0)
+              << " | Tick " << tickCount << " checksum " << std::hex << checksum.value() << std::dec
+              << std::endl;
+}
+
+/**
+ * @brief Hash the gameplay state at the end of a tick (see StateChecksum.h)
+ * Entities in a fixed order: score/lives/level, player, bullets,
+ * mushroom chunks, enemies, centipede chains and their segments.
+ * Particles, sounds and the camera are left out: nothing reads them back
+ * into the simulation. rand() only places the first mushrooms, which are
+ * hashed as tiles; the enemies' own random state is hashed with them.
+ * @param dt Tick length (logged, not hashed)
+ * @param buttons Tick input (logged, not hashed)
+ */
+void Game::hashState(float dt, const InputSnapshot &buttons) {
+    checksum.beginTick(++tickCount, dt, buttons.held, buttons.pressed);
+
+    checksum.beginEntity("game", 0);
+    checksum.addSigned(score);
+    checksum.addSigned(lives);
+    checksum.addSigned(level);
+
+    checksum.beginEntity("player", 0);
+    checksum.addVector(player ? player->getPosition() : sf::Vector2f());
+    checksum.addFloat(Bullet::timeSinceLastShot);
+    checksum.addFloat(respawnTimer);
+
+    int index = 0;
+    for (const Bullet *bullet : Bullet::bullets) {
+        if (bullet->isAlive()) {
+            checksum.beginEntity("bullet", index++);
+            checksum.addVector(bullet->getPosition());
+        }
+    }
+
+    world->hashState(checksum);
+    enemies->hashState(checksum);
+    for (std::size_t i = 0; i < centipedes.size(); i++) {
+        centipedes[i]->hashState(checksum, static_cast<int>(i));
+    }
+
+    checksum.endTick();
+}
+
+/**
+ * @brief Encode the whole session into out (see SaveState.h for the layout)
+ * Sections in order: score/lives/level, player, mushrooms, bullets,
+ * enemies, centipede chains. Particles and sounds are not saved.
+ * @param out Replaced with the save state
+ */
+void Game::saveState(std::vector<std::uint8_t> &out) const {
+    out.clear();
+    SaveWriter writer(out);
+
+    for (char c : SAVE_MAGIC) {
+        writer.writeByte(static_cast<std::uint8_t>(c));
+    }
+    writer.writeVarint(SAVE_VERSION);
+    std::size_t payload = out.size();
+
+    writer.writeSigned(score);
+    writer.writeSigned(lives);
+    writer.writeSigned(level);
+
+    sf::Vector2f playerPosition = player ? player->getPosition() : sf::Vector2f();
+    writer.writeFloat(playerPosition.x);
+    writer.writeFloat(playerPosition.y);
+    writer.writeFloat(respawnTimer);
+
+    world->saveState(writer);
+
+    std::size_t liveBullets = 0;
+    for (const Bullet *bullet : Bullet::bullets) {
+        liveBullets += bullet->isAlive() ? 1 : 0;
+    }
+    writer.writeFloat(Bullet::timeSinceLastShot);
+    writer.writeVarint(liveBullets);
+    sf::Vector2f lastBullet;
+    for (const Bullet *bullet : Bullet::bullets) {
+        if (bullet->isAlive()) {
+            writer.writeDelta(bullet->getPosition(), lastBullet);
+        }
+    }
+
+    enemies->saveState(writer);
+
+    writer.writeVarint(centipedes.size());
+    for (const Centipede *chain : centipedes) {
+        chain->saveState(writer);
+    }
+
+    writer.writeU32(saveHash(out.data() + payload, out.size() - payload));
+}
+
+/**
+ * @brief Replace the running session with a save state
+ * The signature, version and hash are checked first, then every section
+ * is parsed; nothing is applied until all of them have read back. The
+ * mushroom layer is rebuilt under a new session id, unless the caller
+ * keeps it.
+ * @param data Bytes written by saveState()
+ * @param keepMushroomLayer Rewind: keep the session, and send the render
+ *        thread only the cells whose tiles differ from the current ones
+ * @return false if the data is not a usable save state (the session is
+ *         unchanged; a damaged section after a good hash is a writer
+ *         bug and is logged)
+ */
+bool Game::loadState(const std::vector<std::uint8_t> &data, bool keepMushroomLayer) {
+    if (world == nullptr || enemies == nullptr || player == nullptr) {
+        logError("Game", "Cannot load a save state before initialize()");
+        return false;
+    }
+
+    SaveReader header(data.data(), data.size());
+    for (char c : SAVE_MAGIC) {
+        if (header.readByte() != static_cast<std::uint8_t>(c)) {
+            header.fail();
+        }
+    }
+    std::uint64_t version = header.readVarint();
+    if (!header.ok() || header.remaining() < 4) {
+        logError("Game", "Not a save state");
+        return false;
+    }
+    if (version != SAVE_VERSION) {
+        logError("Game", "Save state version " + std::to_string(version) + " is not supported");
+        return false;
+    }
+
+    std::size_t payload = data.size() - header.remaining();
+    std::size_t payloadSize = header.remaining() - 4;
+    SaveReader hash(data.data() + payload + payloadSize, 4);
+    if (hash.readU32() != saveHash(data.data() + payload, payloadSize)) {
+        logError("Game", "Save state is damaged (hash mismatch)");
+        return false;
+    }
+
+    SaveReader reader(data.data() + payload, payloadSize);
+    int savedScore = static_cast<int>(reader.readSigned());
+    int savedLives = static_cast<int>(reader.readSigned());
+    int savedLevel = static_cast<int>(reader.readSigned());
+    float playerX = reader.readFloat();
+    float playerY = reader.readFloat();
+    float savedRespawn = reader.readFloat();
+
+    World::SavedMushrooms savedMushrooms;
+    if (!reader.ok() || !world->parseState(reader, savedMushrooms)) {
+        logError("Game", "Save state has an unreadable mushroom field");
+        return false;
+    }
+
+    float shotTimer = reader.readFloat();
+    std::vector<sf::Vector2f> bulletPositions(reader.readCount(SAVE_MAX_BULLETS));
+    sf::Vector2f lastBullet;
+    for (sf::Vector2f &position : bulletPositions) {
+        position = reader.readDelta(lastBullet);
+    }
+    EnemySystem::SavedState savedEnemies;
+    if (!reader.ok() || !EnemySystem::parseState(reader, savedEnemies)) {
+        logError("Game", "Save state has unreadable bullets or enemies");
+        return false;
+    }
+
+    std::vector<Centipede *> chains;
+    std::size_t chainCount = reader.readCount(SAVE_MAX_CHAINS);
+    for (std::size_t i = 0; i < chainCount && reader.ok(); i++) {
+        Centipede *chain = Centipede::loadState(reader, texture);
+        if (chain != nullptr) {
+            chains.push_back(chain);
+        }
+    }
+    if (!reader.ok() || reader.remaining() != 0) {
+        for (Centipede *chain : chains) {
+            delete chain;
+        }
+        logError("Game", "Save state has unreadable centipede chains");
+        return false;
+    }
+
+    // Everything read: apply the rest
+    score = savedScore;
+    lives = savedLives;
+    level = savedLevel;
+    player->setPosition(playerX, playerY);
+    respawnTimer = savedRespawn;
+
+    for (Bullet *bullet : Bullet::bullets) {
+        delete bullet;
+    }
+    Bullet::bullets.clear();
+    for (const sf::Vector2f &position : bulletPositions) {
+        Bullet *bullet = new Bullet(texture, sf::Vector2i(), Bullet::SPEED);
+        bullet->setPosition(position);
+        Bullet::bullets.push_back(bullet);
+    }
+    Bullet::timeSinceLastShot = shotTimer;
+
+    for (Centipede *chain : centipedes) {
+        delete chain;
+    }
+    centipedes = chains;
+
+    enemies->applyState(savedEnemies);
+
+    std::vector<int> changedCells;
+    if (keepMushroomLayer) {
+        // The layer matches the world once pending damage is sent, so
+        // only the cells that differ from the saved tiles need redrawing
+        processMushroomEvents();
+        world->restoreState(savedMushrooms, changedCells);
+    } else {
+        // New session: the render thread rebuilds its layer from these changes
+        world->applyState(savedMushrooms, changedCells);
+        mushroomSession = ++sessionCounter;
+        mushroomSequence = 0;
+        mushroomLog.clear();
+        dirtyMushrooms.clear();
+    }
+    for (int cell : changedCells) {
+        logMushroom(cell);
+    }
+
+    particles.clear();
+    isGameOver = false;
+    isPaused = false;
+    currentState = GameState::PLAYING;
+    updateCamera();
+    return true;
+}
+
+/**
+ * @brief Write the session to a file
+ * @param path File to create or replace
+ * @return false if the file could not be written
+ */
+bool Game::saveStateFile(const std::string &path) const {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::uint8_t> data;
+    saveState(data);
+    auto encoded = std::chrono::steady_clock::now();
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.write(reinterpret_cast<const char *>(data.data()), data.size())) {
+        logError("Game", "Could not write save state " + path);
+        return false;
+    }
+
+    std::cout << "[Game] Session saved to " << path << ": " << data.size() << " bytes, encoded in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(encoded - start).count()
+              << " us" << std::endl;
+    return true;
+}
+
+/**
+ * @brief Replace the session with one saved by saveStateFile()
+ * @param path File to read
+ * @return false (session unchanged) if the file is missing or unusable
+ */
+bool Game::loadStateFile(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cout << "[Game] No save state at " << path << std::endl;
+        return false;
+    }
+    std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    auto start = std::chrono::steady_clock::now();
+    if (!loadState(data)) {
+        return false;
+    }
+    auto loaded = std::chrono::steady_clock::now();
+
+    std::cout << "[Game] Session loaded from " << path << ": " << data.size() << " bytes, decoded in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(loaded - start).count()
+              << " us" << std::endl;
+    return true;
 }
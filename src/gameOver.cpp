@@ -156,6 +156,12 @@ void GameOverScreen::initialize() {
         submitButton->setColorTextNormal(sf::Color::Black);
         submitButton->setColorTextHover(sf::Color::Yellow);
     }
+
+    // Cache the button rectangles for hit-testing
+    buttons.clear();
+    buttons.add(playAgainButton);
+    buttons.add(mainMenuButton);
+    buttons.add(submitButton);
 }
 
 /**
@@ -179,13 +185,18 @@ GameState GameOverScreen::update(sf::Event &event) {
             }
 
             nameDisplayText.setString(playerName);
+            markDirty();
         }
     }
 
+    Button *pressed = buttons.handleEvent(event, window);
+    if (pressed == nullptr) {
+        return GameState::GAME_OVER;
+    }
+
     // Submit button handling (only if top score and name entered)
-    if (submitButton && isTopScore) {
-        submitButton->update(event, window);
-        if (submitButton->getState() == clicked && !playerName.empty()) {
+    if (pressed == submitButton && isTopScore) {
+        if (!playerName.empty()) {
             std::cout << "[GameOverScreen] Name submitted: " << playerName << std::endl;
 
             // Save score to leaderboard
@@ -206,31 +217,43 @@ GameState GameOverScreen::update(sf::Event &event) {
             playerName = "";
             nameDisplayText.setString("");
 
+            // Drop the submit button so its hidden rectangle no longer takes clicks
+            buttons.clear();
+            buttons.add(playAgainButton);
+            buttons.add(mainMenuButton);
+            delete submitButton;
+            submitButton = nullptr;
+            markDirty();
+
             // Stay on game over screen until Play Again or Main Menu is clicked
         }
+        return GameState::GAME_OVER;
     }
 
     // Play Again button handling
-    if (playAgainButton != nullptr) {
-        playAgainButton->update(event, window);
-        if (playAgainButton->getState() == clicked) {
-            std::cout << "[GameOverScreen] Play Again clicked" << std::endl;
-            return GameState::PLAYING;
-        }
+    if (pressed == playAgainButton) {
+        std::cout << "[GameOverScreen] Play Again clicked" << std::endl;
+        return GameState::PLAYING;
     }
 
     // Main Menu button handling
-    if (mainMenuButton != nullptr) {
-        mainMenuButton->update(event, window);
-        if (mainMenuButton->getState() == clicked) {
-            std::cout << "[GameOverScreen] Main Menu clicked" << std::endl;
-            return GameState::MENU;
-        }
+    if (pressed == mainMenuButton) {
+        std::cout << "[GameOverScreen] Main Menu clicked" << std::endl;
+        return GameState::MENU;
     }
 
     return GameState::GAME_OVER;
 }
 
+/**
+ * @brief Hit-test the mouse once per frame
+ */
+void GameOverScreen::flushInput() {
+    if (buttons.flush(window)) {
+        markDirty();
+    }
+}
+
 /**
  * @brief Render game over screen
  * Shows name input box if isTopScore is true
@@ -264,6 +287,8 @@ void GameOverScreen::render() {
 void GameOverScreen::cleanup() {
     std::cout << "[GameOverScreen] cleanup() called" << std::endl;
 
+    buttons.clear();
+
     if (playAgainButton) {
         delete playAgainButton;
         playAgainButton = nullptr;
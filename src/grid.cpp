@@ -15,6 +15,8 @@
 Grid::Grid(sf::FloatRect Region, int cellSize) {
     mRegion = Region;
     mCellSize = cellSize;
+    mColumns = static_cast<int>(Region.width) / cellSize;
+    mRows = static_cast<int>(Region.height) / cellSize;
 }
 
 /**
@@ -31,3 +33,25 @@ sf::Vector2f Grid::GetPosition(sf::Vector2f position) {
     return sf::Vector2f(snapX, snapY);
 }
 
+/**
+ * @brief Cell (column, row) containing a position
+ *          May be outside 0..columns / 0..rows for positions off the grid
+ * 
+ * @param position      World position
+ * @return sf::Vector2i Column and row
+ */
+sf::Vector2i Grid::GetCell(sf::Vector2f position) const {
+    return sf::Vector2i(static_cast<int>(std::floor((position.x - mRegion.left) / mCellSize)),
+                        static_cast<int>(std::floor((position.y - mRegion.top) / mCellSize)));
+}
+
+/**
+ * @brief World rectangle of a cell
+ * 
+ * @param column Cell column
+ * @param row    Cell row
+ */
+sf::FloatRect Grid::GetCellRect(int column, int row) const {
+    return sf::FloatRect(mRegion.left + column * mCellSize, mRegion.top + row * mCellSize,
+                         mCellSize, mCellSize);
+}
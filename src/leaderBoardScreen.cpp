@@ -32,7 +32,13 @@
  */
 LeaderboardScreen::LeaderboardScreen(sf::RenderWindow &win, sf::Font &fnt)
     : Screen(win, fnt)
-    , backButton(nullptr) {
+    , backButton(nullptr)
+    , rowVertices(sf::Triangles)
+    , rankColumnX(50)
+    , nameColumnX(50)
+    , scoreColumnX(50)
+    , scrollOffset(0)
+    , rowsDirty(true) {
 
     std::cout << "[LeaderboardScreen] Constructor called" << std::endl;
 
@@ -56,6 +62,14 @@ LeaderboardScreen::LeaderboardScreen(sf::RenderWindow &win, sf::Font &fnt)
     headerText.setCharacterSize(27);
     headerText.setFillColor(sf::Color::Yellow);
     headerText.setPosition(50, 170);
+
+    // Line the row columns up with the header words
+    std::string header = headerText.getString();
+    rankColumnX = headerText.findCharacterPos(header.find("RANK")).x;
+    nameColumnX = headerText.findCharacterPos(header.find("PLAYER")).x;
+    scoreColumnX = headerText.findCharacterPos(header.find("SCORE")).x;
+
+    buildGlyphCache();
 }
 
 /**
@@ -80,8 +94,9 @@ void LeaderboardScreen::initialize() {
     // Load leaderboard data from file
     loadFromFile();
 
-    // Format the text for display
-    formatRankText();
+    // Start at the top of the table
+    scrollOffset = 0;
+    rowsDirty = true;
 
     // Create the Back button
     float winWidth = 1200;
@@ -95,6 +110,9 @@ void LeaderboardScreen::initialize() {
     backButton->setColorTextNormal(sf::Color::Black);
     backButton->setColorTextHover(sf::Color::Yellow);
 
+    buttons.clear();
+    buttons.add(backButton);
+
     std::cout << "[LeaderboardScreen] Initialization complete" << std::endl;
 }
 
@@ -102,20 +120,35 @@ void LeaderboardScreen::initialize() {
  * @brief Update - process events and return next state
  *
  * Updates the Back button and checks for clicks.
+ * Mouse wheel and Up/Down/PageUp/PageDown/Home/End scroll the table.
  *
- * Note: Button::update() takes (sf::Event&, sf::RenderWindow&)
- * Note: Button::getState() returns: normal, hovered, or clicked
+ * Note: ButtonGroup::handleEvent() returns the button a click landed on
+ *       (hover changes are resolved once per frame in flushInput())
  *
  * @param event The SFML event to process
  * @return MENU if Back clicked, otherwise LEADERBOARD
  */
 GameState LeaderboardScreen::update(sf::Event &event) {
-    // Update Back button
-    if (backButton != nullptr) {
-        backButton->update(event, window);
-        if (backButton->getState() == clicked) {
-            std::cout << "[LeaderboardScreen] Back clicked - returning to menu" << std::endl;
-            return GameState::MENU;
+    // Back button
+    Button* pressed = buttons.handleEvent(event, window);
+    if (pressed != nullptr && pressed == backButton) {
+        std::cout << "[LeaderboardScreen] Back clicked - returning to menu" << std::endl;
+        return GameState::MENU;
+    }
+
+    // Scroll through the table
+    if (event.type == sf::Event::MouseWheelScrolled &&
+        event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel) {
+        scrollBy(event.mouseWheelScroll.delta > 0 ? -3 : 3);
+    } else if (event.type == sf::Event::KeyPressed) {
+        switch (event.key.code) {
+        case sf::Keyboard::Up:       scrollBy(-1); break;
+        case sf::Keyboard::Down:     scrollBy(1); break;
+        case sf::Keyboard::PageUp:   scrollBy(-(long)VISIBLE_ROWS); break;
+        case sf::Keyboard::PageDown: scrollBy((long)VISIBLE_ROWS); break;
+        case sf::Keyboard::Home:     scrollBy(-(long)entries.size()); break;
+        case sf::Keyboard::End:      scrollBy((long)entries.size()); break;
+        default: break;
         }
     }
     // if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape) {
@@ -127,6 +160,15 @@ GameState LeaderboardScreen::update(sf::Event &event) {
     return GameState::LEADERBOARD;
 }
 
+/**
+ * @brief Hit-test the mouse once per frame
+ */
+void LeaderboardScreen::flushInput() {
+    if (buttons.flush(window)) {
+        markDirty();
+    }
+}
+
 /**
  * @brief Render - draw the leaderboard screen
  *
@@ -134,7 +176,7 @@ GameState LeaderboardScreen::update(sf::Event &event) {
  * 1. Background
  * 2. Title
  * 3. Column headers
- * 4. Ranked entries (1-10)
+ * 4. Visible ranked entries (one vertex array)
  * 5. Back button
  *
  * IMPORTANT: Button inherits from sf::Drawable
@@ -150,10 +192,13 @@ void LeaderboardScreen::render() {
     // Draw header
     window.draw(headerText);
 
-    // Draw all ranked entries
-    for (const auto &rankText : rankTexts) {
-        window.draw(rankText);
+    // Draw the visible ranked entries in a single call
+    if (rowsDirty) {
+        buildRowGeometry();
     }
+    sf::RenderStates states;
+    states.texture = &font.getTexture(ROW_CHARACTER_SIZE);
+    window.draw(rowVertices, states);
 
     // Draw Back button
     if (backButton != nullptr) {
@@ -164,7 +209,7 @@ void LeaderboardScreen::render() {
 /**
  * @brief Add a new score to the leaderboard
  *
- * Inserts a new entry, sorts by score (highest first), keeps top 10.
+ * Inserts a new entry, sorts by score (highest first), keeps MAX_ENTRIES.
  *
  * Example usage from Game class:
  * ```cpp
@@ -185,11 +230,11 @@ void LeaderboardScreen::addScore(const std::string &name, int score) {
     // Sort by score (highest first)
     sortByScore();
 
-    // Keep only top 10
-    keepTop10();
+    // Keep only the best MAX_ENTRIES
+    keepTopEntries();
 
-    // Reformat display text
-    formatRankText();
+    // Rebuild the visible rows on next render
+    rowsDirty = true;
 }
 
 /**
@@ -202,12 +247,12 @@ void LeaderboardScreen::addScore(const std::string &name, int score) {
  */
 bool LeaderboardScreen::isTopScore(int score) const {
     // If leaderboard has fewer than 10 entries, any score qualifies
-    if (entries.size() < 10) {
+    if (entries.size() < TOP_SCORE_COUNT) {
         return true;
     }
 
-    // Check if score is higher than the lowest entry (which is last after sorting)
-    if (score > entries.back().score) {
+    // Check if score is higher than the 10th entry (entries are sorted)
+    if (score > entries[TOP_SCORE_COUNT - 1].score) {
         return true;
     }
 
@@ -248,7 +293,6 @@ void LeaderboardScreen::loadFromFile() {
 
     while (file >> name >> score) {
         entries.push_back(LeaderboardEntry(name, score));
-        std::cout << "[LeaderboardScreen] Loaded: " << name << " - " << score << std::endl;
     }
 
     // Close the file
@@ -257,8 +301,9 @@ void LeaderboardScreen::loadFromFile() {
     // Sort entries by score (highest first)
     sortByScore();
 
-    // Keep only top 10
-    keepTop10();
+    // Keep only the best MAX_ENTRIES
+    keepTopEntries();
+    rowsDirty = true;
 
     std::cout << "[LeaderboardScreen] Loaded " << entries.size() << " entries" << std::endl;
 }
@@ -307,56 +352,113 @@ void LeaderboardScreen::sortByScore() {
 }
 
 /**
- * @brief Keep only top 10 entries
+ * @brief Keep only the best MAX_ENTRIES entries
  *
- * Removes any entries beyond position 10.
+ * Removes any entries beyond position MAX_ENTRIES.
  */
-void LeaderboardScreen::keepTop10() {
-    // If we have more than 10 entries, erase the extras
-    if (entries.size() > 10) {
-        entries.erase(entries.begin() + 10, entries.end());
+void LeaderboardScreen::keepTopEntries() {
+    // If we have more than MAX_ENTRIES entries, erase the extras
+    if (entries.size() > MAX_ENTRIES) {
+        entries.erase(entries.begin() + MAX_ENTRIES, entries.end());
     }
 }
 
 /**
- * @brief Format the rank text for display
+ * @brief Cache glyph metrics for printable ASCII
  *
- * Creates sf::Text objects for each entry to be displayed.
- * Format: "1.  PlayerName         12500"
+ * Font::getGlyph() rasterises a glyph into the font's texture page the
+ * first time it is asked for, so doing it here means every row character
+ * is already in the page and later lookups are plain array reads.
  */
-void LeaderboardScreen::formatRankText() {
-    std::cout << "[LeaderboardScreen] Formatting rank text" << std::endl;
+void LeaderboardScreen::buildGlyphCache() {
+    for (sf::Uint32 c = 32; c < 127; c++) {
+        const sf::Glyph &glyph = font.getGlyph(c, ROW_CHARACTER_SIZE, false);
+        CachedGlyph &cached = glyphCache[c - 32];
+        cached.advance = glyph.advance;
+        cached.bounds = glyph.bounds;
+        cached.textureRect = glyph.textureRect;
+    }
+}
+
+/**
+ * @brief Move the first visible row by a number of rows
+ *
+ * @param rows Rows to scroll (negative scrolls up)
+ */
+void LeaderboardScreen::scrollBy(long rows) {
+    long maxOffset = (long)entries.size() - (long)VISIBLE_ROWS;
+    if (maxOffset < 0) {
+        maxOffset = 0;
+    }
 
-    // Clear existing rank texts
-    rankTexts.clear();
+    long newOffset = std::clamp((long)scrollOffset + rows, 0L, maxOffset);
+    if ((std::size_t)newOffset != scrollOffset) {
+        scrollOffset = newOffset;
+        rowsDirty = true;
+        markDirty();
+    }
+}
+
+/**
+ * @brief Rebuild the vertex array for the visible rows
+ *
+ * Each row is "rank." in the RANK column, the name in the PLAYER NAME
+ * column and the score in the SCORE column, so no space padding is needed.
+ * Six vertices (two triangles) per visible character.
+ */
+void LeaderboardScreen::buildRowGeometry() {
+    rowVertices.clear();
 
-    // Create text for each entry
     float startY = 240;    // Y position for first entry
     float lineHeight = 35; // Space between entries
 
-    for (long unsigned int i = 0; i < entries.size(); i++) {
-        sf::Text rankText;
-        rankText.setFont(font);
-        rankText.setCharacterSize(25);
-        rankText.setFillColor(sf::Color::White);
+    std::size_t end = std::min(entries.size(), scrollOffset + VISIBLE_ROWS);
+    for (std::size_t i = scrollOffset; i < end; i++) {
+        float baseline = startY + (i - scrollOffset) * lineHeight + ROW_CHARACTER_SIZE;
+
+        appendString(std::to_string(i + 1) + ".", rankColumnX, baseline);
+        appendString(entries[i].name, nameColumnX, baseline);
+        appendString(std::to_string(entries[i].score), scoreColumnX, baseline);
+    }
+
+    rowsDirty = false;
+}
 
-        // Format: "1.  PlayerName:         Score"
-        // Using string operands and space counting for nice formatting
-        std::string line = std::to_string(i + 1) + "." +
-                           std::string(20 - (entries[i].name.length() + std::to_string(i + 1).length()), ' ') +
-                           entries[i].name + ":" +
-                           std::string(20 - (std::to_string(entries[i].score).length()), ' ') +
-                           std::to_string(entries[i].score);
+/**
+ * @brief Append the quads for one string to rowVertices
+ *
+ * @param str Text to lay out
+ * @param x Left edge of the text
+ * @param baseline Baseline y position
+ */
+void LeaderboardScreen::appendString(const std::string &str, float x, float baseline) {
+    for (char ch : str) {
+        unsigned char c = static_cast<unsigned char>(ch);
+        if (c < 32 || c > 126) {
+            c = '?';
+        }
 
-        rankText.setString(line);
-        rankText.setPosition(50, startY + (i * lineHeight));
+        const CachedGlyph &glyph = glyphCache[c - 32];
 
-        rankTexts.push_back(rankText);
+        float left = x + glyph.bounds.left;
+        float top = baseline + glyph.bounds.top;
+        float right = left + glyph.bounds.width;
+        float bottom = top + glyph.bounds.height;
 
-        std::cout <<line <<std::endl;
-    }
+        float u1 = static_cast<float>(glyph.textureRect.left);
+        float v1 = static_cast<float>(glyph.textureRect.top);
+        float u2 = u1 + glyph.textureRect.width;
+        float v2 = v1 + glyph.textureRect.height;
+
+        rowVertices.append(sf::Vertex(sf::Vector2f(left, top), sf::Color::White, sf::Vector2f(u1, v1)));
+        rowVertices.append(sf::Vertex(sf::Vector2f(right, top), sf::Color::White, sf::Vector2f(u2, v1)));
+        rowVertices.append(sf::Vertex(sf::Vector2f(left, bottom), sf::Color::White, sf::Vector2f(u1, v2)));
+        rowVertices.append(sf::Vertex(sf::Vector2f(left, bottom), sf::Color::White, sf::Vector2f(u1, v2)));
+        rowVertices.append(sf::Vertex(sf::Vector2f(right, top), sf::Color::White, sf::Vector2f(u2, v1)));
+        rowVertices.append(sf::Vertex(sf::Vector2f(right, bottom), sf::Color::White, sf::Vector2f(u2, v2)));
 
-    std::cout << "[LeaderboardScreen] Formatted " << rankTexts.size() << " rank texts" << std::endl;
+        x += glyph.advance;
+    }
 }
 
 /**
@@ -367,6 +469,8 @@ void LeaderboardScreen::formatRankText() {
 void LeaderboardScreen::cleanup() {
     std::cout << "[LeaderboardScreen] cleanup() called" << std::endl;
 
+    buttons.clear();
+
     if (backButton != nullptr) {
         delete backButton;
         backButton = nullptr;
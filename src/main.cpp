@@ -12,7 +12,12 @@
 #include "../includes/game.h"
 #include "../includes/Game_State.h"
 #include "../includes/ScreenManager.h"
+#include "../includes/RenderThread.h"
+#include "../includes/DebugOptions.h"
+#include "../includes/FrameLimiter.h"
 #include <cstddef>
+#include <cstdio>
+#include <ctime>
 #include <iostream>
 #include <SFML/Graphics.hpp>
 #include <SFML/System/Clock.hpp>
@@ -33,6 +38,12 @@
  * - Renders the appropriate system (UI or Gameplay)
  * - Maintains consistent frame rate at 60 FPS
  *
+ * Gameplay frames are drawn by the RenderThread: the main thread only
+ * publishes a FrameSnapshot, so vsync stalls in display() no longer
+ * eat into simulation time. A FramePacer times both threads so input is
+ * sampled just before the frame that shows it gets drawn. Menus are
+ * still drawn on the main thread.
+ *
  * The game uses a state machine with two main branches:
  * - Menu states (MENU, SETTINGS, LEADERBOARD): Handled by ScreenManager
  * - Gameplay states (PLAYING, PAUSED, GAME_OVER): Handled by Game class
@@ -53,11 +64,14 @@
  *      └→ MENU (quit to menu)
  * ```
  *
+ * Command line switches are described in DebugOptions.h.
+ *
  * @return 0 on successful exit, 1 on error
  */
-int main() {
+int main(int argc, char *argv[]) {
     try {
-        srand(time(NULL));
+        DebugOptions debugOptions = DebugOptions::parse(argc, argv);
+        srand(debugOptions.seed != 0 ? debugOptions.seed : time(NULL));
         std::cout << "========================================" << std::endl;
         std::cout << "     CENTIPEDE GAME - Starting" << std::endl;
         std::cout << "========================================" << std::endl;
@@ -81,7 +95,7 @@ int main() {
             sf::Style::Default);
 
         /**
-         * Set frame rate limit to 60 FPS
+         * Limit the frame rate (60 FPS unless --fps says otherwise)
          * This prevents the game from running as fast as possible
          * and consuming 100% CPU. Instead, it limits to 60 frames/second.
          *
@@ -94,11 +108,16 @@ int main() {
          * - Smooth, consistent gameplay at 60 FPS
          * - Frame-independent movement (dt adapts to actual frame time)
          * - Predictable gameplay experience
+         *
+         * window.setFramerateLimit() uses sf::sleep, which on Linux can
+         * wake a millisecond or more late, so menus use a FrameLimiter
+         * (sleep, then spin) and gameplay uses the FramePacer, which
+         * waits the same way.
          */
-        window.setFramerateLimit(60);
+        FrameLimiter menuLimiter(debugOptions.frameRate);
 
         std::cout << "[main] Window created: 1200x800" << std::endl;
-        std::cout << "[main] Frame rate limited to 60 FPS" << std::endl;
+        std::cout << "[main] Frame rate limited to " << debugOptions.frameRate << " FPS" << std::endl;
 
         // ========== CLOCK SETUP ==========
 
@@ -116,6 +135,14 @@ int main() {
          */
         sf::Clock clock;
 
+        /**
+         * CPU usage log (--cpu-log)
+         * std::clock() is CPU time of the whole process (all threads), so
+         * CPU time / wall time is the average core usage since the last log.
+         */
+        sf::Clock cpuLogClock;
+        std::clock_t cpuLogStart = std::clock();
+
         // ========== UI SYSTEM SETUP ==========
 
         /**
@@ -144,6 +171,21 @@ int main() {
 
         std::cout << "[main] ScreenManager initialized" << std::endl;
 
+        // ========== RENDER THREAD SETUP ==========
+
+        /**
+         * Create the render thread (not started yet)
+         * It takes over the window while the game is PLAYING and draws
+         * the latest FrameSnapshot published by the simulation.
+         *
+         * The frame pacer schedules both sides around each present: the
+         * render thread starts drawing as late as it safely can, and the
+         * simulation (with its input sample) runs just before that.
+         */
+        FramePacer framePacer(debugOptions.frameRate);
+        framePacer.setLatencyLog(debugOptions.latencyLog);
+        RenderThread renderThread(window, screenManager.getFont(), framePacer);
+
         // ========== GAMEPLAY SYSTEM SETUP ==========
 
         /**
@@ -158,6 +200,7 @@ int main() {
          * - Reusing the same Game object preserves continuity
          */
         Game *game = nullptr;
+        bool resumePending = !debugOptions.resumeFile.empty();   // --resume: next game loads the file
 
         // When Start button is pressed:
 
@@ -191,6 +234,29 @@ int main() {
              */
             float dt = clock.restart().asSeconds();
 
+            // ===== IDLE WAIT =====
+
+            /**
+             * A menu with nothing new to draw blocks here until the next
+             * event instead of redrawing the same frame at 60 FPS, so an
+             * idle menu costs (almost) no CPU. Screens mark themselves dirty
+             * when an event changes what they show (a hover, a click, a
+             * transition); otherwise only Resized and GainedFocus force a
+             * redraw. Either way the screen is redrawn once and we block
+             * again.
+             *
+             * The clock restarts after waking so the time spent waiting
+             * never reaches the game as one huge dt.
+             */
+            sf::Event event;
+            bool haveEvent = false;
+            if (screenManager.getState() != GameState::PLAYING && !renderThread.isRunning() &&
+                !screenManager.needsRedraw()) {
+                haveEvent = window.waitEvent(event);
+                clock.restart();
+                menuLimiter.restart();
+            }
+
             // ===== EVENT PROCESSING =====
 
             /**
@@ -198,15 +264,17 @@ int main() {
              * Events include: mouse movement, clicks, key presses, window resize, etc.
              *
              * sf::Event::pollEvent() returns true if an event occurred, false if no more events
-             * We loop until all events are processed
+             * We loop until all events are processed (starting with the one
+             * the idle wait returned, if any)
              */
-            sf::Event event;
-            while (window.pollEvent(event)) {
+            while (haveEvent || window.pollEvent(event)) {
+                haveEvent = false;
 
                 // Check if window close button was clicked
                 // This sets window.isOpen() to false, ending the main loop
                 if (event.type == sf::Event::Closed) {
                     std::cout << "[main] Window close requested" << std::endl;
+                    renderThread.stop(); // Window must not be closed under the render thread
                     window.close();
                     break; // Exit event loop, next iteration of main loop will see isOpen() = false
                 }
@@ -347,8 +415,16 @@ int main() {
                      */
                     if (game == nullptr) {
                         std::cout << "[main] Creating Game object for PLAYING state\n";
-                        game = new Game(window, screenManager);
+                        game = new Game(window, screenManager, debugOptions);
                         game->initialize(); // Initialize the game (get settings, create objects)
+
+                        // Suspend/resume: the first game continues the saved session, once
+                        if (resumePending) {
+                            resumePending = false;
+                            if (game->loadStateFile(debugOptions.resumeFile)) {
+                                std::remove(debugOptions.resumeFile.c_str());
+                            }
+                        }
                         std::cout << "[main] Game initialized and ready to play\n";
                     }
 
@@ -368,6 +444,14 @@ int main() {
                 }
             }
 
+            /**
+             * Menus hit-test the mouse once per frame, after every event
+             * of the frame was handled (mouse moves are coalesced)
+             */
+            if (screenManager.getState() != GameState::PLAYING) {
+                screenManager.flushInput();
+            }
+
             // ===== UPDATING =====
 
             /**
@@ -393,7 +477,8 @@ int main() {
                  */
                 
                 if (game != nullptr) {
-                    game->update(dt);
+                    // Checksum runs use a fixed tick so two runs line up
+                    game->update(debugOptions.checksumFile.empty() ? dt : 1.0f / debugOptions.frameRate);
 
                     // Check if Game class changed state (e.g., PLAYING -> PAUSED or GAME_OVER)
                     GameState newState = game->getState();
@@ -417,46 +502,101 @@ int main() {
             // ===== RENDERING =====
 
             /**
-             * Clear the window (paint it black)
-             * This removes everything from last frame so we can draw fresh
+             * Render based on the state AFTER updating, so the render thread
+             * is stopped before any menu draws (and before a menu click can
+             * delete the Game whose atlas the render thread is using)
              */
-            window.clear(sf::Color::Black);
+            GameState renderState = screenManager.getState();
 
-            /**
-             * Render based on current state
-             * Each system draws its own content
-             */
-            if (currentState == GameState::PLAYING) {
+            if (renderState == GameState::PLAYING && game != nullptr) {
                 /**
                  * Render gameplay
-                 * Draws: background, mushrooms, centipede, bullets, player, HUD
+                 * Copy the frame into a snapshot and hand it to the render
+                 * thread; it draws the cached mushroom layer, centipede,
+                 * bullets, player and HUD while we carry on simulating.
                  */
-                if (game != nullptr) {
-                    game->render();
+                if (!renderThread.isRunning()) {
+                    renderThread.start();
                 }
+                game->buildSnapshot(renderThread.beginFrame(), renderThread.getMushroomAck());
+                renderThread.publish();
+                framePacer.simulationDone();
+
+                /**
+                 * Sleep FIRST: the next iteration polls events, samples
+                 * input and simulates right before the render thread's
+                 * next latch, instead of sleeping after a finished frame
+                 */
+                framePacer.waitToSimulate();
             } else {
                 /**
-                 * Render UI screen
+                 * Render UI screen on this thread
                  * Draws: buttons, menus, leaderboard, pause screen, etc.
                  * ScreenManager forwards to the appropriate Screen object
                  */
-                screenManager.render();
+                renderThread.stop();
+
+                /**
+                 * Only redraw when the screen changed; otherwise the next
+                 * iteration blocks in the idle wait
+                 */
+                if (screenManager.needsRedraw()) {
+                    /**
+                     * Clear the window (paint it black)
+                     * This removes everything from last frame so we can draw fresh
+                     */
+                    window.clear(sf::Color::Black);
+
+                    screenManager.render();
+
+                    /**
+                     * Display the rendered frame
+                     * Swaps buffers so the user sees what we just drew
+                     * This is called once per frame, at the end
+                     */
+                    window.display();
+                    menuLimiter.wait();
+                }
             }
 
+            // ===== CPU USAGE LOG =====
+
             /**
-             * Display the rendered frame
-             * Swaps buffers so the user sees what we just drew
-             * This is called once per frame, at the end
+             * Logged on the first frame after each 5 s window; while a menu
+             * is blocked in the idle wait the window simply gets longer
              */
-            window.display();
+            if (debugOptions.cpuLog && cpuLogClock.getElapsedTime() >= sf::seconds(5)) {
+                std::clock_t cpuNow = std::clock();
+                double cpuSeconds = static_cast<double>(cpuNow - cpuLogStart) / CLOCKS_PER_SEC;
+                double wallSeconds = cpuLogClock.restart().asSeconds();
+                cpuLogStart = cpuNow;
+
+                std::cout << "[main] CPU usage: " << (100.0 * cpuSeconds / wallSeconds)
+                          << "% of one core over " << wallSeconds << " s (state "
+                          << static_cast<int>(screenManager.getState()) << ")" << std::endl;
+            }
 
         } // End main loop
 
+        renderThread.stop();
+
+        if (debugOptions.frameStats) {
+            framePacer.getFrameTimes().print("gameplay");
+            menuLimiter.getFrameTimes().print("menu");
+        }
+
         /**
          * Clean up and delete the Game object before exiting
          * This ensures all game resources are properly cleaned up
          */
         if (game != nullptr) {
+            // Suspend: keep a running game for the next start
+            GameState finalState = game->getState();
+            if (!debugOptions.resumeFile.empty() &&
+                (finalState == GameState::PLAYING || finalState == GameState::PAUSED)) {
+                game->saveStateFile(debugOptions.resumeFile);
+            }
+
             std::cout << "[main] Cleaning up Game object" << std::endl;
             game->cleanup(); // Call cleanup() to free game resources
             delete game;     // Delete the Game object itself
@@ -1,131 +1,256 @@
 /**
  * @file    mushroom.cpp
  * @author  Ian Codding II, Balin Becker
- * @brief   Mushroom Class Definitions
+ * @brief   Mushroom Field Definitions
  * @date    2025-10-21
  */
 
 #include "../includes/mushroom.h"
-#include <iostream>
-using std::cerr;
-using std::endl;
+#include <algorithm>
+#include <cmath>
 
-const int MAXHEALTH = 4;
+const int MAXHEALTH = atlas::MUSHROOM_MAX_HEALTH;
 
 /**
- * @brief Construct a new Mushroom:: Mushroom object w/ float vector2 and health
+ * @brief Construct an empty field covering every cell of the grid
  *
- * @param pos   Vector2f position
- * @param hp    0 < hp <= 4 Number of hitpoints/health
+ * @param grid Grid whose cells the field uses
  */
-Mushroom::Mushroom(sf::Texture &texture, sf::IntRect spriteTexture, sf::Vector2f pos, int hp, bool isSuper)
-    : c_obj(texture, spriteTexture, pos, "Mushroom") {
+MushroomField::MushroomField(const Grid &grid)
+    : mOrigin(grid.GetRegion().left, grid.GetRegion().top),
+      mCellSize(static_cast<float>(grid.GetCellSize())),
+      mColumns(grid.GetColumns()),
+      mRows(grid.GetRows()),
+      mCount(0),
+      mTiles(static_cast<std::size_t>(grid.GetColumns()) * grid.GetRows(), 0) {
+}
+
+/**
+ * @brief Construct an empty field of columns x rows cells at origin
+ *
+ * @param origin    World position of the top-left cell
+ * @param cellSize  Cell size in pixels
+ */
+MushroomField::MushroomField(sf::Vector2f origin, float cellSize, int columns, int rows)
+    : mOrigin(origin),
+      mCellSize(cellSize),
+      mColumns(columns),
+      mRows(rows),
+      mCount(0),
+      mTiles(static_cast<std::size_t>(columns) * rows, 0) {
+}
 
-    if (isSuper) {
-        mShroomState = super;
-    } else {
-        mShroomState = normal;
+/**
+ * @brief Put a mushroom in an empty cell
+ *
+ * @param cell      Cell index
+ * @param hp        0 < hp <= 4 Number of hitpoints/health (clamped)
+ * @param isSuper   Super mushroom
+ * @return true if placed, false if the cell was taken
+ */
+bool MushroomField::place(int cell, int hp, bool isSuper) {
+    if (!isEmpty(cell)) {
+        return false;
     }
 
     if (hp <= 0)
-        mHealth = 1;
+        hp = 1;
     else if (hp >= MAXHEALTH)
-        mHealth = MAXHEALTH;
+        hp = MAXHEALTH;
 
-    updateTexture();
-    mSprite.setScale(2, 2);
+    mTiles[cell] = static_cast<std::uint8_t>(hp) | (isSuper ? SUPER_FLAG : 0);
+    mCount++;
+    return true;
 }
 
 /**
- * @brief Damages mushroom for percentage
+ * @brief Damages the mushroom in a cell for int points
  *
- * @param dmg Percentage of hit points
+ * @param cell  Cell index
+ * @param dmg   Number of hit points
+ * @return true if the mushroom was destroyed
  */
-void Mushroom::hit(float dmg) {
-    int hp = mHealth * dmg;
-    hit(hp);
+bool MushroomField::hit(int cell, int dmg) {
+    int hp = health(cell);
+    if (hp == 0 || dmg <= 0) {
+        return false;
+    }
+
+    hp = (dmg >= hp) ? 0 : hp - dmg;
+    if (hp == 0) {
+        mTiles[cell] = 0;
+        mCount--;
+        return true;
+    }
+
+    mTiles[cell] = static_cast<std::uint8_t>(hp) | (mTiles[cell] & SUPER_FLAG);
+    return false;
 }
 
 /**
- * @brief Damages muchroom for int points
- *
- * @param dmg Number of hit points
+ * @brief Remove every mushroom
  */
-void Mushroom::hit(int dmg) {
-    if (dmg >= mHealth) {
-        mHealth -= mHealth;
-    } else if (dmg <= 0) {
-        mHealth -= 0;
-    } else {
-        mHealth -= dmg;
-    }
+void MushroomField::clear() {
+    std::fill(mTiles.begin(), mTiles.end(), 0);
+    mCount = 0;
+}
+
+/**
+ * @brief Cells a rectangle overlaps, clamped to the field
+ *          Same overlap rule as sf::FloatRect::intersects (touching edges miss)
+ * @return false if the rectangle misses the field entirely
+ */
+bool MushroomField::cellRange(const sf::FloatRect &bounds, int &col1, int &row1, int &col2, int &row2) const {
+    float left = (bounds.left - mOrigin.x) / mCellSize;
+    float top = (bounds.top - mOrigin.y) / mCellSize;
+    float right = (bounds.left + bounds.width - mOrigin.x) / mCellSize;
+    float bottom = (bounds.top + bounds.height - mOrigin.y) / mCellSize;
 
-    updateTexture();
+    col1 = std::max(0, static_cast<int>(std::floor(left)));
+    row1 = std::max(0, static_cast<int>(std::floor(top)));
+    col2 = std::min(mColumns - 1, static_cast<int>(std::ceil(right)) - 1);
+    row2 = std::min(mRows - 1, static_cast<int>(std::ceil(bottom)) - 1);
+
+    return col1 <= col2 && row1 <= row2;
 }
 
 /**
- * @brief Updates the texture on the mushroom
+ * @brief First mushroom cell a rectangle overlaps (bottom row first)
  *
+ * @param bounds World rectangle, e.g. a bullet
+ * @return Cell index, or -1 if none
  */
-void Mushroom::updateTexture() {
-    // if (mHealth == 0 or mShroomState == destroy) {
-    //     // Destroy
-    // }
-
-    switch (mShroomState) {
-    case normal:
-        if (mHealth > (MAXHEALTH * 0.75)) { // If > 75%
-            // Full Mushroom
-            setSpriteRect(sf::IntRect(8 * 8, 8 * 2, 8, 8));
-        } else if (mHealth > (MAXHEALTH * 0.5) and mHealth <= (MAXHEALTH * 0.75)) { // If  > 50% and < 75%
-            // Hit Mushroom
-            setSpriteRect(sf::IntRect(8 * 9, 8 * 2, 8, 8));
-        } else if (mHealth > (MAXHEALTH * 0.25) and mHealth <= (MAXHEALTH * 0.5)) { // If > 25% and < 50%
-            // Damaged Mushroom
-            setSpriteRect(sf::IntRect(8 * 10, 8 * 2, 8, 8));
-        } else if (mHealth > 0 and mHealth <= (MAXHEALTH * 0.25)) { // If > 0 and < 25%
-            // Broken Mushroom
-            setSpriteRect(sf::IntRect(8 * 11, 8 * 2, 8, 8));
+int MushroomField::firstHit(const sf::FloatRect &bounds) const {
+    int col1, row1, col2, row2;
+    if (!cellRange(bounds, col1, row1, col2, row2)) {
+        return -1;
+    }
+
+    // Bullets travel up, so the lowest mushroom is the one they reach first
+    for (int row = row2; row >= row1; row--) {
+        for (int col = col1; col <= col2; col++) {
+            int cell = cellIndex(col, row);
+            if (mTiles[cell] != 0) {
+                return cell;
+            }
         }
+    }
+    return -1;
+}
 
-        break;
-
-    case super:
-        if (mHealth > (MAXHEALTH * 0.75)) { // If > 75%
-            // Full Mushroom
-            setSpriteRect(sf::IntRect(8 * 8, 8 * 3, 8, 8));
-        } else if (mHealth > (MAXHEALTH * 0.5) and mHealth < (MAXHEALTH * 0.75)) { // If > 50% and < 75%
-            // Hit Mushroom
-            setSpriteRect(sf::IntRect(8 * 9, 8 * 3, 8, 8));
-        } else if (mHealth > (MAXHEALTH * 0.25) and mHealth < (MAXHEALTH * 0.5)) { // If > 25% and < 50%
-            // Damaged Mushroom
-            setSpriteRect(sf::IntRect(8 * 10, 8 * 3, 8, 8));
-        } else if (mHealth > 0 and mHealth < (MAXHEALTH * 0.25)) { // If > 0 and < 25%
-            // Broken Mushroom
-            setSpriteRect(sf::IntRect(8 * 11, 8 * 3, 8, 8));
+/**
+ * @brief Whether a rectangle overlaps any mushroom
+ */
+bool MushroomField::anyInRect(const sf::FloatRect &bounds) const {
+    int col1, row1, col2, row2;
+    if (!cellRange(bounds, col1, row1, col2, row2)) {
+        return false;
+    }
+
+    for (int row = row1; row <= row2; row++) {
+        for (int col = col1; col <= col2; col++) {
+            if (mTiles[cellIndex(col, row)] != 0) {
+                return true;
+            }
         }
+    }
+    return false;
+}
+
+/**
+ * @brief Sprite of the mushroom in a cell, filling the cell
+ *
+ * @param cell Cell index (must not be empty)
+ */
+SpriteInstance MushroomField::spriteAt(int cell) const {
+    return tileSprite(mTiles[cell], sf::Vector2f(mOrigin.x + (cell % mColumns) * mCellSize,
+                                                 mOrigin.y + (cell / mColumns) * mCellSize), mCellSize);
+}
+
+/**
+ * @brief Sprite of a tile byte drawn in the cell at position
+ *
+ * @param tile      Tile byte (must hold a mushroom)
+ * @param position  Top-left of the cell
+ */
+SpriteInstance MushroomField::tileSprite(std::uint8_t tile, sf::Vector2f position, float cellSize) {
+    const atlas::Frame &frame = atlas::MUSHROOM_FRAMES[(tile & SUPER_FLAG) ? 1 : 0][tile & HEALTH_MASK];
 
-        break;
+    SpriteInstance instance;
+    instance.position = position;
+    instance.origin = sf::Vector2f(0, 0);
+    instance.scale = sf::Vector2f(cellSize / frame.width, cellSize / frame.height);
+    instance.textureRect = frame.rect();
+    return instance;
+}
+
+/**
+ * @brief Turn a mushroom into a poisoned (super) one
+ *
+ * @param cell  Cell index
+ * @return true if the cell changed
+ */
+bool MushroomField::poison(int cell) {
+    if (isEmpty(cell) || isSuper(cell)) {
+        return false;
     }
+    mTiles[cell] |= SUPER_FLAG;
+    return true;
 }
 
 /**
- * @brief
+ * @brief Run-length encode the tiles
+ *          Format: (run length 1-255, tile byte) pairs. Mostly-empty
+ *          fields shrink to a few bytes per row.
  *
- * @param e
- * @param window
+ * @param out Receives the encoded bytes (replaced)
+ */
+void MushroomField::pack(std::vector<std::uint8_t> &out) const {
+    out.clear();
+
+    std::size_t i = 0;
+    while (i < mTiles.size()) {
+        std::uint8_t value = mTiles[i];
+        std::size_t run = 1;
+        while (i + run < mTiles.size() && mTiles[i + run] == value && run < 255) {
+            run++;
+        }
+        out.push_back(static_cast<std::uint8_t>(run));
+        out.push_back(value);
+        i += run;
+    }
+}
+
+/**
+ * @brief Restore tiles written by pack()
+ *          Runs past the end of the field are ignored
  */
-void Mushroom::update() {
-    updateTexture();
+void MushroomField::unpack(const std::vector<std::uint8_t> &in) {
+    std::fill(mTiles.begin(), mTiles.end(), 0);
+    mCount = 0;
+
+    std::size_t cell = 0;
+    for (std::size_t i = 0; i + 1 < in.size(); i += 2) {
+        for (int run = 0; run < in[i] && cell < mTiles.size(); run++, cell++) {
+            mTiles[cell] = in[i + 1];
+            if (in[i + 1] & HEALTH_MASK) {
+                mCount++;
+            }
+        }
+    }
 }
 
 /**
- * @brief tells me if you died
- * 
- * @return true 
- * @return false 
+ * @brief Tile byte of one cell in bytes written by pack(), without
+ *          decoding the rest
+ * @return The tile, or 0 past the last run
  */
-bool Mushroom::isDestroyed() const
-{
-    return mHealth <= 0;
-}
\ No newline at end of file
+std::uint8_t MushroomField::packedTile(const std::vector<std::uint8_t> &in, int cell) {
+    for (std::size_t i = 0; i + 1 < in.size(); i += 2) {
+        if (cell < in[i]) {
+            return in[i + 1];
+        }
+        cell -= in[i];
+    }
+    return 0;
+}
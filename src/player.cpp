@@ -16,7 +16,7 @@ void Player::startPlayer(sf::RectangleShape &rectangle, sf::Texture &playerTextu
     rectangle.setSize(sf::Vector2f(30.f, 30.f));
     rectangle.setOutlineColor(sf::Color::Black);
     // rectangle.setOutlineThickness(5.f); // Do we need this?
-    rectangle.setPosition(400.f, 500.f);
+    resetPlayer(rectangle);
 
     // Load player texture
 
@@ -33,17 +33,24 @@ void Player::startPlayer(sf::RectangleShape &rectangle, sf::Texture &playerTextu
     // player->setScale(sf::Vector2f(3,3));
 }
 
-void Player::movePlayer(sf::RectangleShape &playerRectangle, float deltaTime, const sf::FloatRect &gridBounds) {
+// Back to the start position (new game, or after losing a life)
+void Player::resetPlayer(sf::RectangleShape &rectangle) {
+    rectangle.setPosition(400.f, 500.f);
+}
+
+// Keys come from the tick's InputSnapshot (sampled on the input thread)
+void Player::movePlayer(sf::RectangleShape &playerRectangle, float deltaTime, const sf::FloatRect &gridBounds,
+                        const InputSnapshot &input) {
     sf::Vector2f pos = playerRectangle.getPosition();
     float speed = 500.f;
 
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::A) || sf::Keyboard::isKeyPressed(sf::Keyboard::Left))
+    if (input.isDown(INPUT_LEFT))
         pos.x -= speed * deltaTime;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::D) || sf::Keyboard::isKeyPressed(sf::Keyboard::Right))
+    if (input.isDown(INPUT_RIGHT))
         pos.x += speed * deltaTime;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::W) || sf::Keyboard::isKeyPressed(sf::Keyboard::Up))
+    if (input.isDown(INPUT_UP))
         pos.y -= speed * deltaTime;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::S) || sf::Keyboard::isKeyPressed(sf::Keyboard::Down))
+    if (input.isDown(INPUT_DOWN))
         pos.y += speed * deltaTime;
 
     // Use grid bounds instead of hard-coded numbers
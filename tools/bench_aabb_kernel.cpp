@@ -0,0 +1,131 @@
+/**
+ * @file bench_aabb_kernel.cpp
+ * @author Roman Salazar
+ * @brief Batch AABB overlap: FloatRect loop vs the scalar, SSE2 and AVX2 mask kernels
+ * @version 1.0
+ * @date 2025-12-22
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Usage: bin/bench_aabb_kernel        (build and run with: make bench)
+ *
+ * For 1k, 10k and 100k random 16x16 boxes (about one box per four cells
+ * of area, like a busy mushroom field), runs 500 bullet-sized queries
+ * (2x8) and writes a hit mask per query with:
+ * - a loop of sf::FloatRect::intersects over an array of FloatRects
+ * - aabb::overlapMasksScalar
+ * - aabb::overlapMasksSse2 and aabb::overlapMasksAvx2 (x86, AVX2 only if
+ *   this CPU has it)
+ * Every kernel's masks must match the FloatRect loop's. Each is timed 5
+ * times; the best run is reported, in microseconds per query.
+ */
+
+#include "../includes/aabb_kernel.h"
+#include "tool_common.h"
+#include <SFML/Graphics/Rect.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+const float BOX = 16.0f;
+const int QUERIES = 500;
+const int RUNS = 5;
+
+struct Boxes {
+    std::vector<sf::FloatRect> rects;
+    std::vector<float> minX, minY, maxX, maxY;
+};
+
+typedef void (*KernelFn)(float, float, float, float, const float*, const float*, const float*, const float*,
+                         std::size_t, std::uint8_t*);
+
+/**
+ * @brief The test getCollided() ran per collider, writing the same masks as the kernels
+ */
+void floatRectLoop(const Boxes& boxes, const sf::FloatRect& region, std::uint8_t* masks) {
+    std::fill(masks, masks + aabb::maskBytes(boxes.rects.size()), 0);
+    for (std::size_t i = 0; i < boxes.rects.size(); i++) {
+        if (region.intersects(boxes.rects[i])) {
+            masks[i / 8] |= static_cast<std::uint8_t>(1u << (i % 8));
+        }
+    }
+}
+
+/**
+ * @brief Best-of-RUNS time per query; masks holds every query's result
+ */
+template <typename Query>
+double timeQueries(Query query, std::size_t queries, std::vector<std::uint8_t>& masks, std::size_t stride) {
+    return tools::bestOfMicros(RUNS, [&]() {
+        for (std::size_t q = 0; q < queries; q++) {
+            query(q, &masks[q * stride]);
+        }
+    }) / queries;
+}
+
+void runSize(std::size_t count) {
+    tools::Random random(static_cast<std::uint32_t>(count));
+    float side = std::sqrt(static_cast<float>(count) * 4.0f) * BOX;
+
+    Boxes boxes;
+    for (std::size_t i = 0; i < count; i++) {
+        float x = random.next(side), y = random.next(side);
+        boxes.rects.emplace_back(x, y, BOX, BOX);
+        boxes.minX.push_back(x);
+        boxes.minY.push_back(y);
+        boxes.maxX.push_back(x + BOX);
+        boxes.maxY.push_back(y + BOX);
+    }
+
+    std::vector<sf::FloatRect> regions;
+    for (int q = 0; q < QUERIES; q++) {
+        regions.emplace_back(random.next(side), random.next(side), 2, 8);
+    }
+
+    std::size_t stride = aabb::maskBytes(count);
+    std::vector<std::uint8_t> expected(stride * QUERIES), masks(stride * QUERIES);
+
+    double loop = timeQueries([&](std::size_t q, std::uint8_t* out) { floatRectLoop(boxes, regions[q], out); },
+                              QUERIES, expected, stride);
+    std::printf("  %6zu boxes  %-18s %8.2f us/query\n", count, "FloatRect loop", loop);
+
+    auto runKernel = [&](const char* name, KernelFn kernel) {
+        std::fill(masks.begin(), masks.end(), 0xFF);
+        double time = timeQueries(
+            [&](std::size_t q, std::uint8_t* out) {
+                const sf::FloatRect& r = regions[q];
+                kernel(r.left, r.top, r.left + r.width, r.top + r.height, boxes.minX.data(), boxes.minY.data(),
+                       boxes.maxX.data(), boxes.maxY.data(), count, out);
+            },
+            QUERIES, masks, stride);
+        std::printf("  %6zu boxes  %-18s %8.2f us/query  %5.1fx  %s\n", count, name, time, loop / time,
+                    masks == expected ? "same hits" : "HITS DIFFER");
+        return masks == expected;
+    };
+
+    bool same = runKernel("scalar mask", aabb::overlapMasksScalar);
+#if defined(__x86_64__) || defined(__i386__)
+    same = runKernel("SSE2", aabb::overlapMasksSse2) && same;
+    if (aabb::hasAvx2()) {
+        same = runKernel("AVX2", aabb::overlapMasksAvx2) && same;
+    }
+#endif
+    if (!same) {
+        std::printf("[bench_aabb_kernel] A kernel's masks differ from the FloatRect loop\n");
+    }
+}
+
+} // namespace
+
+int main() {
+    std::printf("[bench_aabb_kernel] %d queries per size, best of %d runs, overlapMasks uses %s\n", QUERIES, RUNS,
+                aabb::implementationName());
+    runSize(1000);
+    runSize(10000);
+    runSize(100000);
+    return 0;
+}
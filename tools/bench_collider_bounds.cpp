@@ -0,0 +1,164 @@
+/**
+ * @file bench_collider_bounds.cpp
+ * @author Ian Codding II
+ * @brief Collider queries with bounds recomputed per test vs the cached AABB arrays
+ * @version 1.0
+ * @date 2025-12-22
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Usage: bin/bench_collider_bounds        (build and run with: make bench)
+ *
+ * Fills an ecs::Registry with 10k static mushroom colliders (16x16 atlas
+ * rect, scale 1) on a 100x100 grid of cells, plus 2k bullets that share
+ * the collider array, and runs 2000 bullet-sized queries (mask: mushrooms
+ * only) at random places. Three ways to answer them:
+ * - recompute bounds per query: builds every collider's box from
+ *   Transform + Sprite and tests it with sf::FloatRect::intersects, as
+ *   getCollided() did before the AABB cache
+ * - cached scalar scan: a plain loop over the registry's packed
+ *   minX/minY/maxX/maxY arrays
+ * - Registry::query as it is now (the SIMD mask kernel)
+ * All three must report the same hits. Each is timed 5 times; the best
+ * run is reported, in microseconds per query.
+ */
+
+#include "../includes/entity_registry.h"
+#include "tool_common.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+const int GRID = 100;            // Mushrooms per side
+const float CELL = 16.0f;
+const int BULLETS = 2000;
+const int QUERIES = 2000;
+const int RUNS = 5;
+
+ecs::Entity addObject(ecs::Registry& reg, sf::Vector2f position, sf::IntRect rect, ecs::EntityType type) {
+    ecs::Entity e = reg.create();
+    ecs::Transform transform;
+    transform.position = position;
+    ecs::Sprite sprite;
+    sprite.rect = rect;
+    ecs::Collider collider;
+    collider.type = type;
+    collider.category = ecs::layerOf(type);
+
+    reg.transforms.add(e, transform);
+    reg.sprites.add(e, sprite);
+    reg.addCollider(e, collider);
+    return e;
+}
+
+/**
+ * @brief Recompute every collider's bounds per query
+ */
+void queryRecompute(const ecs::Registry& reg, const sf::FloatRect& region, std::uint32_t mask,
+                    std::vector<ecs::Entity>& out) {
+    const ecs::Collider* colliders = reg.colliders.data();
+    for (std::size_t i = 0; i < reg.colliders.size(); i++) {
+        if ((colliders[i].category & mask) == 0) {
+            continue;
+        }
+        if (region.intersects(reg.bounds(reg.colliders.entityAt(i)))) {
+            out.push_back(reg.colliders.entityAt(i));
+        }
+    }
+}
+
+/**
+ * @brief Scalar scan of the cached AABB arrays (no dirty slots here)
+ */
+void queryCachedScan(const ecs::Registry& reg, const sf::FloatRect& region, std::uint32_t mask,
+                     std::vector<ecs::Entity>& out) {
+    const float left = region.left;
+    const float top = region.top;
+    const float right = region.left + region.width;
+    const float bottom = region.top + region.height;
+
+    const ecs::Collider* collider = reg.colliders.data();
+    const float* minX = reg.aabbs.minX.data();
+    const float* minY = reg.aabbs.minY.data();
+    const float* maxX = reg.aabbs.maxX.data();
+    const float* maxY = reg.aabbs.maxY.data();
+
+    for (std::size_t i = 0; i < reg.colliders.size(); i++) {
+        if ((collider[i].category & mask) == 0) {
+            continue;
+        }
+        if (minX[i] < right && maxX[i] > left && minY[i] < bottom && maxY[i] > top) {
+            out.push_back(reg.colliders.entityAt(i));
+        }
+    }
+}
+
+void queryCurrent(const ecs::Registry& reg, const sf::FloatRect& region, std::uint32_t mask,
+                  std::vector<ecs::Entity>& out) {
+    reg.query(region, mask, out);
+}
+
+typedef void (*QueryFn)(const ecs::Registry&, const sf::FloatRect&, std::uint32_t, std::vector<ecs::Entity>&);
+
+/**
+ * @brief Best-of-RUNS time per query, and every hit of the last run
+ */
+double timeQueries(QueryFn query, const ecs::Registry& reg, const std::vector<sf::FloatRect>& regions,
+                   std::vector<std::vector<ecs::Entity>>& hits) {
+    return tools::bestOfMicros(RUNS, [&]() {
+        for (std::size_t q = 0; q < regions.size(); q++) {
+            hits[q].clear();
+            query(reg, regions[q], ecs::LAYER_DEFAULT, hits[q]);
+        }
+    }) / regions.size();
+}
+
+} // namespace
+
+int main() {
+    ecs::Registry reg;
+    tools::Random random(2025);
+
+    // Bullets interleaved with the mushrooms, like objects created during play
+    int bulletEvery = (GRID * GRID) / BULLETS;
+    for (int i = 0; i < GRID * GRID; i++) {
+        sf::Vector2f cell((i % GRID) * CELL, (i / GRID) * CELL);
+        addObject(reg, cell, sf::IntRect(0, 0, 16, 16), ecs::EntityType::Default);
+        if (i % bulletEvery == 0) {
+            addObject(reg, sf::Vector2f(random.next(GRID * CELL), random.next(GRID * CELL)), sf::IntRect(0, 0, 2, 8),
+                      ecs::EntityType::Bullet);
+        }
+    }
+    reg.refreshBounds();
+
+    std::vector<sf::FloatRect> regions;
+    for (int q = 0; q < QUERIES; q++) {
+        regions.emplace_back(random.next(GRID * CELL), random.next(GRID * CELL), 2, 8);
+    }
+
+    std::printf("[bench_collider_bounds] %zu colliders (%d mushrooms), %d queries, best of %d runs\n",
+                reg.colliders.size(), GRID * GRID, QUERIES, RUNS);
+
+    std::vector<std::vector<ecs::Entity>> expected(QUERIES), hits(QUERIES);
+    double recompute = timeQueries(queryRecompute, reg, regions, expected);
+    double cached = timeQueries(queryCachedScan, reg, regions, hits);
+    bool cachedSame = hits == expected;
+    double current = timeQueries(queryCurrent, reg, regions, hits);
+    bool currentSame = hits == expected;
+
+    std::size_t total = 0;
+    for (const auto& list : expected) {
+        total += list.size();
+    }
+
+    std::printf("  %-44s %8.2f us/query\n", "recompute bounds per query", recompute);
+    std::printf("  %-44s %8.2f us/query  %.1fx  %s\n", "cached scalar scan", cached, recompute / cached,
+                cachedSame ? "same hits" : "HITS DIFFER");
+    std::printf("  %-44s %8.2f us/query  %.1fx  %s\n", "Registry::query (SIMD mask kernel)", current,
+                recompute / current, currentSame ? "same hits" : "HITS DIFFER");
+    std::printf("  %zu hits in total\n", total);
+    return cachedSame && currentSame ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file bench_enemies.cpp
+ * @author Balin Becker
+ * @brief Simulation cost per tick with the --stress enemy population
+ * @date 2025-12-23
+ *
+ * Usage: bin/bench_enemies        (build and run with: make bench)
+ *
+ * Runs 3600 ticks (one minute at 60 FPS) of the enemy side of
+ * Game::update() on the default 950x720 World, starting with 60
+ * mushrooms (fleas drop more as the run goes on), and tops the population
+ * up to 600 enemies every tick as --stress does (Game::STRESS_ENEMIES).
+ * Each tick is timed as a whole:
+ * - spawn top-up, EnemySystem::update() (kernels, mushroom changes)
+ * - refreshBounds, integrateVelocities, updateAnimations
+ * - 20 bullet broad-phase queries (World::firstHit + Registry::query)
+ * - removeDead() and World::indexEntities()
+ * - the snapshot's culling pass over a 1200x800 view
+ * Everything runs on one thread; the game spreads the movement and
+ * broad-phase over its job system. Centipede chains, audio and drawing
+ * are not included: for the whole frame with a window, run
+ * ./centipede --stress --frame-stats, which prints frame-time
+ * percentiles on exit.
+ *
+ * Exit code: 0 if the population averaged at least 95 % of 600, 1 otherwise.
+ */
+
+#include "../includes/enemies.h"
+#include "tool_common.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+const int TICKS = 3600;
+const float DT = 1.0f / 60.0f;
+const std::size_t ENEMIES = 600;
+const int MUSHROOMS = 60;
+const int BULLETS = 20;
+const double BUDGET_US = 1e6 / 60.0;
+const sf::FloatRect VIEW(0, 0, 1200, 800);
+
+} // namespace
+
+int main() {
+    Grid grid(sf::FloatRect(125, 80, 950, 720), 16);
+    World world(grid);
+    sf::Texture texture;
+    EnemySystem enemies(texture);
+    ecs::Registry& reg = ecs::registry();
+    tools::Random random(40);
+
+    for (int placed = 0; placed < MUSHROOMS;) {
+        if (world.place(random.next(world.getColumns() * world.getRows()))) {
+            placed++;
+        }
+    }
+
+    sf::FloatRect region = grid.GetRegion();
+    std::vector<int> changedCells;
+    std::vector<ecs::Entity> hits, candidates;
+    std::vector<SpriteInstance> sprites;
+    std::vector<double> tickUs;
+    std::size_t population = 0, drawn = 0;
+    int bulletHits = 0;
+
+    for (int tick = 0; tick < TICKS; tick++) {
+        auto start = std::chrono::steady_clock::now();
+
+        int kind = 0;
+        while (enemies.count() < ENEMIES && enemies.spawn(static_cast<EnemyKind>(kind), region)) {
+            kind = (kind + 1) % static_cast<int>(EnemyKind::Count);
+        }
+        enemies.update(DT, world, region, changedCells);
+        changedCells.clear();
+        population += enemies.count();
+
+        reg.refreshBounds();
+        reg.integrateVelocities(DT, 0, reg.velocities.size());
+        reg.updateAnimations(DT);
+
+        for (int b = 0; b < BULLETS; b++) {
+            sf::FloatRect bounds(region.left + random.next(region.width), region.top + random.next(region.height), 2, 8);
+            bulletHits += world.firstHit(bounds) >= 0;
+            hits.clear();
+            reg.query(bounds, ecs::LAYER_CENTIPEDE | ecs::LAYER_ENEMY, hits);
+            bulletHits += !hits.empty();
+        }
+
+        enemies.removeDead();
+        world.indexEntities(reg);
+
+        candidates.clear();
+        sprites.clear();
+        world.collectEntities(VIEW, candidates);
+        reg.collectVisibleSprites(ecs::EntityType::Flea, candidates, VIEW, sprites);
+        reg.collectVisibleSprites(ecs::EntityType::Spider, candidates, VIEW, sprites);
+        reg.collectVisibleSprites(ecs::EntityType::Scorpion, candidates, VIEW, sprites);
+        drawn += sprites.size();
+
+        tickUs.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    double total = 0;
+    for (double us : tickUs) {
+        total += us;
+    }
+    std::sort(tickUs.begin(), tickUs.end());
+    double mean = total / TICKS;
+    double p99 = tickUs[static_cast<std::size_t>(TICKS * 0.99)];
+    double worst = tickUs.back();
+
+    std::printf("[bench_enemies] %d ticks, %zu enemies on average, %zu drawn, %d mushrooms left, %d bullet hits\n",
+                TICKS, population / TICKS, drawn / TICKS, static_cast<int>(world.count()), bulletHits);
+    std::printf("  %-6s %8.1f us/tick  %5.2f %% of a 60 FPS frame\n", "mean", mean, 100.0 * mean / BUDGET_US);
+    std::printf("  %-6s %8.1f us/tick  %5.2f %%\n", "p99", p99, 100.0 * p99 / BUDGET_US);
+    std::printf("  %-6s %8.1f us/tick  %5.2f %%\n", "max", worst, 100.0 * worst / BUDGET_US);
+    return population / TICKS >= ENEMIES - ENEMIES / 20 ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file bench_flow_field.cpp
+ * @author Balin Becker
+ * @brief Centipede head decisions: FlowField table lookup vs the probe box
+ * @date 2025-12-22
+ *
+ * Usage: bin/bench_flow_field        (build and run with: make bench)
+ *
+ * Builds the default 950x720 World with 400 random mushrooms (1 in 10
+ * poisoned) and times 1M head decisions at random aligned cells and
+ * headings, both ways Centipede::move() can make them:
+ * - probe: the quarter-width box ahead of the head, World::firstHit(),
+ *   isPoisoned() and the grid bounds test
+ * - table: World::alignedCell() and FlowField::next()
+ * Also counts the heads where the two disagree. The only expected ones
+ * are heads in the last full column heading right: the probe lets them
+ * step into the 6px past it, the table turns them.
+ */
+
+#include "../includes/World.h"
+#include "tool_common.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+const int HEADS = 1000000;
+const int MUSHROOMS = 400;
+const int RUNS = 5;
+
+struct Head {
+    sf::FloatRect bounds;
+    bool right, down;
+};
+
+/**
+ * @brief What the head does next: 0 forward, 1 turn, 2 dive
+ */
+int probeDecision(const World& world, const Grid& grid, const Head& head) {
+    float lookDir = head.right ? 16.0f : -16.0f;
+    sf::FloatRect frontHitbox(head.bounds.left + lookDir, head.bounds.top, head.bounds.width / 4, head.bounds.height);
+    int ahead = world.firstHit(frontHitbox);
+    if (ahead >= 0) {
+        return world.isPoisoned(ahead) ? 2 : 1;
+    }
+    return frontHitbox.intersects(grid.GetRegion()) ? 0 : 1;
+}
+
+int tableDecision(const World& world, const Head& head) {
+    int cell = world.alignedCell(head.bounds);
+    FlowField::Move next = world.getFlow().next(cell, head.right, head.down);
+    if (next == FlowField::Move::Dive) {
+        return 2;
+    }
+    return (next == FlowField::Move::Down || next == FlowField::Move::Up) ? 1 : 0;
+}
+
+/**
+ * @brief Best-of-RUNS time per decision; decisions holds the last run's
+ */
+template <typename Decide>
+double timeDecisions(Decide decide, const std::vector<Head>& heads, std::vector<std::uint8_t>& decisions) {
+    return tools::bestOfMicros(RUNS, [&]() {
+        for (std::size_t i = 0; i < heads.size(); i++) {
+            decisions[i] = static_cast<std::uint8_t>(decide(heads[i]));
+        }
+    }) * 1000.0 / heads.size();
+}
+
+} // namespace
+
+int main() {
+    Grid grid(sf::FloatRect(125, 80, 950, 720), 16);
+    World world(grid);
+    tools::Random random(39);
+
+    for (int placed = 0; placed < MUSHROOMS;) {
+        int cell = random.next(world.getColumns() * world.getRows());
+        if (world.place(cell, MAXHEALTH, random.next(10) == 0)) {
+            placed++;
+        }
+    }
+
+    std::vector<Head> heads(HEADS);
+    sf::Vector2f origin = world.getOrigin();
+    for (Head& head : heads) {
+        int column = random.next(world.getColumns());
+        int row = random.next(world.getRows());
+        head.bounds = sf::FloatRect(origin.x + column * 16.0f, origin.y + row * 16.0f, 16, 16);
+        head.right = random.next(2) == 1;
+        head.down = random.next(2) == 1;
+    }
+
+    std::vector<std::uint8_t> probe(HEADS), table(HEADS);
+    double probeNs = timeDecisions([&](const Head& head) { return probeDecision(world, grid, head); }, heads, probe);
+    double tableNs = timeDecisions([&](const Head& head) { return tableDecision(world, head); }, heads, table);
+
+    int differ = 0, rightEdge = 0;
+    for (int i = 0; i < HEADS; i++) {
+        if (probe[i] == table[i]) {
+            continue;
+        }
+        differ++;
+        int column = static_cast<int>((heads[i].bounds.left - origin.x) / 16);
+        if (heads[i].right && column == world.getColumns() - 1) {
+            rightEdge++;
+        }
+    }
+
+    std::printf("[bench_flow_field] %dx%d cells, %d mushrooms, %d heads, best of %d runs\n", world.getColumns(),
+                world.getRows(), MUSHROOMS, HEADS, RUNS);
+    std::printf("  %-10s %6.1f ns/decision\n", "probe", probeNs);
+    std::printf("  %-10s %6.1f ns/decision  %.1fx\n", "table", tableNs, probeNs / tableNs);
+    std::printf("  %d decisions differ, %d of them heading right in the last full column\n", differ, rightEdge);
+    return differ == rightEdge ? 0 : 1;
+}
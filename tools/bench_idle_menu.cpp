@@ -0,0 +1,208 @@
+/**
+ * @file bench_idle_menu.cpp
+ * @author Ian Codding II
+ * @brief CPU cost of a menu that nobody touches, and of one under mouse moves
+ * @version 1.0
+ * @date 2025-12-21
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Usage: bin/bench_idle_menu        (build and run with: make bench)
+ *
+ * A model of the menu part of main.cpp's loop, using the real
+ * FrameLimiter. No window is needed: waitEvent() is a condition variable
+ * fed by an input thread, and a redraw is a software clear of a 1200x800
+ * frame standing in for clear / draw / display (the GPU and driver work
+ * of a real redraw comes on top). Four cases, 3 s each:
+ * - redraw every frame at 60 FPS, whether or not anything changed
+ * - block in the idle wait, no input
+ * - mouse moves at 125 Hz over the menu buttons, every event dirties the
+ *   screen (ScreenManager::update before hover tracking)
+ * - the same moves, dirty only when the hovered button changes
+ * CPU is process CPU time over wall time, as --cpu-log reports it.
+ */
+
+#include "../includes/FrameLimiter.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const int WIDTH = 1200;
+const int HEIGHT = 800;
+const std::uint64_t RUN_US = 3000000;
+const std::uint64_t MOUSE_PERIOD_US = 8000;   // 125 Hz, a common mouse report rate
+
+// The four main-menu buttons: 300x50, centred, 90 px apart
+struct Rect { int left, top, width, height; };
+const Rect BUTTONS[] = {{450, 300, 300, 50}, {450, 390, 300, 50}, {450, 480, 300, 50}, {450, 570, 300, 50}};
+
+/**
+ * @brief Stand-in for sf::Window::waitEvent()/pollEvent() with mouse moves only
+ */
+class EventQueue {
+public:
+    void push(int x, int y) {
+        std::lock_guard<std::mutex> lock(mutex);
+        events.push_back(x | y << 16);
+        ready.notify_one();
+    }
+
+    bool wait(int& event, std::uint64_t deadline) {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (events.empty()) {
+            std::uint64_t now = FrameLimiter::nowMicros();
+            if (now >= deadline) {
+                return false;
+            }
+            ready.wait_for(lock, std::chrono::microseconds(deadline - now));
+        }
+        event = events.front();
+        events.pop_front();
+        return true;
+    }
+
+    bool poll(int& event) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (events.empty()) {
+            return false;
+        }
+        event = events.front();
+        events.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<int> events;
+};
+
+int hitTest(int x, int y) {
+    for (int i = 0; i < 4; i++) {
+        const Rect& r = BUTTONS[i];
+        if (x >= r.left && x < r.left + r.width && y >= r.top && y < r.top + r.height) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+std::vector<std::uint32_t> frame(WIDTH * HEIGHT);
+
+void redraw(int hovered) {
+    std::fill(frame.begin(), frame.end(), 0xFF000000u);
+    for (int i = 0; i < 4; i++) {
+        const Rect& r = BUTTONS[i];
+        std::uint32_t color = (i == hovered) ? 0xFF00FFFFu : 0xFF00FF00u;
+        for (int y = r.top; y < r.top + r.height; y++) {
+            std::fill(&frame[y * WIDTH + r.left], &frame[y * WIDTH + r.left + r.width], color);
+        }
+    }
+}
+
+enum class Mode { RedrawAlways, IdleNoInput, MouseDirtyEveryEvent, MouseDirtyOnHover };
+
+/**
+ * @brief Cursor sweeping up and down across the button column, 125 reports a second
+ */
+void moveMouse(EventQueue& queue, std::atomic<bool>& running) {
+    // Plain sleeps: FrameLimiter's spin would be charged to the menu
+    auto next = std::chrono::steady_clock::now();
+    int step = 0;
+    while (running) {
+        int y = 250 + (step % 200 < 100 ? step % 100 : 100 - step % 100) * 4;   // 250..650 and back
+        queue.push(600 + (step % 7), y);
+        step++;
+        next += std::chrono::microseconds(MOUSE_PERIOD_US);
+        std::this_thread::sleep_until(next);
+    }
+}
+
+void run(const char* label, Mode mode) {
+    EventQueue queue;
+    std::atomic<bool> running(true);
+    std::thread input;
+    if (mode == Mode::MouseDirtyEveryEvent || mode == Mode::MouseDirtyOnHover) {
+        input = std::thread(moveMouse, std::ref(queue), std::ref(running));
+    }
+
+    FrameLimiter limiter(60);
+    bool dirty = true;
+    int hovered = -1;
+    int cursorX = 0, cursorY = 0;
+    bool cursorMoved = false;
+    std::uint64_t redraws = 0, wakeups = 0;
+
+    std::uint64_t start = FrameLimiter::nowMicros();
+    std::uint64_t end = start + RUN_US;
+    std::clock_t cpuStart = std::clock();
+
+    while (FrameLimiter::nowMicros() < end) {
+        int event = 0;
+        bool haveEvent = false;
+        if (mode != Mode::RedrawAlways && !dirty) {
+            haveEvent = queue.wait(event, end);
+            limiter.restart();
+            wakeups++;
+        }
+
+        while (haveEvent || queue.poll(event)) {
+            haveEvent = false;
+            cursorX = event & 0xFFFF;
+            cursorY = event >> 16;
+            cursorMoved = true;
+            if (mode == Mode::MouseDirtyEveryEvent) {
+                dirty = true;
+            }
+        }
+
+        // flushInput(): one hit-test per frame
+        if (cursorMoved) {
+            cursorMoved = false;
+            int now = hitTest(cursorX, cursorY);
+            if (now != hovered) {
+                hovered = now;
+                dirty = true;
+            }
+        }
+
+        if (mode == Mode::RedrawAlways || dirty) {
+            redraw(hovered);
+            dirty = false;
+            redraws++;
+            limiter.wait();
+        }
+    }
+
+    double cpu = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    double wall = (FrameLimiter::nowMicros() - start) / 1e6;
+    running = false;
+    if (input.joinable()) {
+        input.join();
+    }
+
+    std::printf("  %-44s %6.2f %% CPU  %6.1f redraws/s  %6.1f wakeups/s\n", label, 100.0 * cpu / wall,
+                redraws / wall, wakeups / wall);
+}
+
+} // namespace
+
+int main() {
+    std::printf("[bench_idle_menu] %dx%d software redraw, 60 FPS limit, %.0f s per case\n", WIDTH, HEIGHT,
+                RUN_US / 1e6);
+    run("redraw every frame", Mode::RedrawAlways);
+    run("idle wait, no input", Mode::IdleNoInput);
+    run("mouse moving, every event dirties", Mode::MouseDirtyEveryEvent);
+    run("mouse moving, dirty on hover change only", Mode::MouseDirtyOnHover);
+    return 0;
+}
@@ -0,0 +1,253 @@
+/**
+ * @file check_world_streaming.cpp
+ * @author Ian Codding II
+ * @brief Checks that chunk streaming never changes what the world holds
+ * @version 1.0
+ * @date 2025-12-22
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Usage: bin/check_world_streaming        (build and run with: make check-world)
+ *
+ * Builds a World the size of the game's --world 4x3 (4 fields wide, 3
+ * tall: 8x5 chunks), fills it with mushrooms of every health, some of them
+ * poisoned, and records what every cell holds. Then, with a 1200x800
+ * camera:
+ * - streaming packs the far chunks, and every cell still reads back the
+ *   same through the packed tiles (isEmpty, isPoisoned, spriteAt), as do
+ *   count() and the state checksum
+ * - firstHit() and anyInRect() on a packed chunk find its mushrooms and
+ *   leave it packed; hit() unpacks it and the damage sticks
+ * - a camera sweep over the whole world keeps the chunks under the view
+ *   active, packs the distant ones, and never loses a tile on the way
+ * - a save state taken with chunks packed loads into a fresh world
+ *
+ * Exit code: 0 all checks pass, 1 otherwise.
+ */
+
+#include "../includes/World.h"
+#include "tool_common.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+const float FIELD_WIDTH = 950.0f;    // Game::FIELD_WIDTH / FIELD_HEIGHT
+const float FIELD_HEIGHT = 720.0f;
+const int WORLD_FIELDS_X = 4;
+const int WORLD_FIELDS_Y = 3;
+const sf::Vector2f VIEW_SIZE(1200, 800);
+
+int failures = 0;
+
+void check(bool condition, const char* what) {
+    if (!condition) {
+        std::cout << "  FAIL: " << what << std::endl;
+        failures++;
+    }
+}
+
+/**
+ * @brief What one cell is expected to hold
+ */
+struct Cell {
+    bool empty = true;
+    bool poisoned = false;
+    sf::IntRect textureRect;
+    sf::Vector2f position;
+};
+
+std::vector<Cell> snapshotCells(const World& world) {
+    std::vector<Cell> cells(static_cast<std::size_t>(world.getColumns()) * world.getRows());
+    for (std::size_t cell = 0; cell < cells.size(); cell++) {
+        int index = static_cast<int>(cell);
+        cells[cell].empty = world.isEmpty(index);
+        if (!cells[cell].empty) {
+            cells[cell].poisoned = world.isPoisoned(index);
+            SpriteInstance sprite = world.spriteAt(index);
+            cells[cell].textureRect = sprite.textureRect;
+            cells[cell].position = sprite.position;
+        }
+    }
+    return cells;
+}
+
+/**
+ * @brief Number of cells whose contents differ from the expected ones
+ */
+int countMismatches(const World& world, const std::vector<Cell>& expected) {
+    std::vector<Cell> actual = snapshotCells(world);
+    int mismatches = 0;
+    for (std::size_t cell = 0; cell < expected.size(); cell++) {
+        const Cell& a = actual[cell];
+        const Cell& e = expected[cell];
+        if (a.empty != e.empty ||
+            (!e.empty && (a.poisoned != e.poisoned || a.textureRect != e.textureRect || a.position != e.position))) {
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+std::uint64_t hashWorld(const World& world) {
+    StateChecksum sum;
+    sum.beginTick(0, 0, 0, 0);
+    world.hashState(sum);
+    return sum.endTick();
+}
+
+int countPacked(const World& world) {
+    int packed = 0;
+    for (int chunk = 0; chunk < world.getChunkCount(); chunk++) {
+        packed += world.isActive(chunk) ? 0 : 1;
+    }
+    return packed;
+}
+
+sf::FloatRect viewAt(sf::Vector2f topLeft) {
+    return sf::FloatRect(topLeft.x, topLeft.y, VIEW_SIZE.x, VIEW_SIZE.y);
+}
+
+/**
+ * @brief Chunks under the view must be active, chunks two chunks or more
+ *          past the active margin must be packed
+ */
+bool streamedAroundView(const World& world, const sf::FloatRect& view) {
+    float margin = (World::ACTIVE_MARGIN + 1) * world.getChunkPixels();
+    sf::FloatRect far(view.left - margin, view.top - margin, view.width + 2 * margin, view.height + 2 * margin);
+    for (int chunk = 0; chunk < world.getChunkCount(); chunk++) {
+        sf::FloatRect rect = world.getChunkRect(chunk);
+        if (rect.intersects(view) && !world.isActive(chunk)) {
+            return false;
+        }
+        if (!rect.intersects(far) && world.isActive(chunk)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Rectangle of one cell, shrunk so it only touches that cell
+ */
+sf::FloatRect cellBounds(const World& world, int cell) {
+    float size = world.getChunkPixels() / World::CHUNK_CELLS;
+    sf::Vector2f origin = world.getOrigin();
+    return sf::FloatRect(origin.x + (cell % world.getColumns()) * size + 2, origin.y + (cell / world.getColumns()) * size + 2,
+                         size - 4, size - 4);
+}
+
+} // namespace
+
+int main() {
+    Grid grid(sf::FloatRect(125, 80, FIELD_WIDTH * WORLD_FIELDS_X, FIELD_HEIGHT * WORLD_FIELDS_Y), 16);
+    World world(grid);
+    const int cellCount = world.getColumns() * world.getRows();
+    std::cout << "[check_world_streaming] " << world.getColumns() << "x" << world.getRows() << " cells, "
+              << world.getChunkCount() << " chunks" << std::endl;
+
+    // ===== FILL =====
+    tools::Random random(12345);
+    for (int i = 0; i < cellCount / 12; i++) {
+        int cell = random.next(cellCount);
+        world.place(cell, 1 + random.next(MAXHEALTH), random.next(10) == 0);
+        if (random.next(8) == 0) {
+            world.poison(cell);
+        }
+    }
+    std::vector<Cell> expected = snapshotCells(world);
+    std::size_t expectedCount = world.count();
+    std::uint64_t expectedHash = hashWorld(world);
+    std::cout << "  " << expectedCount << " mushrooms placed" << std::endl;
+
+    // ===== PACK =====
+    sf::FloatRect view = viewAt(world.getOrigin());
+    world.stream(view);
+    int packed = countPacked(world);
+    std::cout << "  View at the top left: " << packed << " of " << world.getChunkCount() << " chunks packed in "
+              << world.packedBytes() << " bytes" << std::endl;
+    check(packed >= world.getChunkCount() / 2, "at least half the chunks packed with the camera in a corner");
+    check(streamedAroundView(world, view), "chunks under the view active, distant ones packed");
+    check(countMismatches(world, expected) == 0, "every cell reads back the same through packed tiles");
+    check(world.count() == expectedCount, "count() unchanged by packing");
+    check(hashWorld(world) == expectedHash, "state checksum unchanged by packing");
+
+    // ===== QUERIES ON A PACKED CHUNK =====
+    int packedCell = -1;
+    for (int cell = cellCount - 1; cell >= 0 && packedCell < 0; cell--) {
+        if (!expected[cell].empty && !world.isActive(world.chunkOfCell(cell))) {
+            packedCell = cell;
+        }
+    }
+    check(packedCell >= 0, "a packed chunk holds a mushroom");
+    if (packedCell >= 0) {
+        int chunk = world.chunkOfCell(packedCell);
+        sf::FloatRect bounds = cellBounds(world, packedCell);
+        check(world.firstHit(bounds) == packedCell, "firstHit() finds a mushroom in a packed chunk");
+        check(world.anyInRect(bounds), "anyInRect() finds a mushroom in a packed chunk");
+        check(!world.isActive(chunk), "read-only queries leave the chunk packed");
+
+        world.hit(packedCell, MAXHEALTH);
+        check(world.isActive(chunk), "hit() unpacks the chunk");
+        check(world.isEmpty(packedCell), "the hit mushroom is gone");
+        check(world.count() == expectedCount - 1, "count() follows the hit");
+        expected[packedCell] = Cell();
+        expectedCount--;
+
+        world.stream(view);
+        check(!world.isActive(chunk), "the next stream() packs the chunk again");
+        check(world.isEmpty(packedCell), "the hit survives repacking");
+    }
+
+    // ===== CAMERA SWEEP =====
+    // Row by row across the whole world, a quarter chunk per step
+    sf::Vector2f origin = world.getOrigin();
+    float step = world.getChunkPixels() / 4;
+    sf::Vector2f end(origin.x + FIELD_WIDTH * WORLD_FIELDS_X - VIEW_SIZE.x,
+                     origin.y + FIELD_HEIGHT * WORLD_FIELDS_Y - VIEW_SIZE.y);
+    int steps = 0, badSteps = 0, badCells = 0;
+    std::size_t mostActive = 0;
+    for (float y = origin.y; y <= end.y; y += step) {
+        for (float x = origin.x; x <= end.x; x += step) {
+            view = viewAt(sf::Vector2f(x, y));
+            world.stream(view);
+            badSteps += streamedAroundView(world, view) ? 0 : 1;
+            if (steps % 8 == 0) {
+                badCells += countMismatches(world, expected);
+            }
+            mostActive = std::max<std::size_t>(mostActive, world.getChunkCount() - countPacked(world));
+            steps++;
+        }
+    }
+    std::cout << "  Camera sweep: " << steps << " steps, at most " << mostActive << " chunks active" << std::endl;
+    check(badSteps == 0, "every step keeps the view active and packs the distant chunks");
+    check(badCells == 0, "no tile lost or changed during the sweep");
+    check(countMismatches(world, expected) == 0, "every cell the same after the sweep");
+    check(world.count() == expectedCount, "count() the same after the sweep");
+
+    // ===== SAVE STATE =====
+    std::vector<std::uint8_t> bytes;
+    SaveWriter out(bytes);
+    world.saveState(out);
+    out.flushBits();
+
+    World loaded(grid);
+    SaveReader in(bytes.data(), bytes.size());
+    std::vector<int> placedCells;
+    check(loaded.loadState(in, placedCells), "save state taken with packed chunks loads");
+    loaded.stream(view);
+    std::cout << "  Save state: " << bytes.size() << " bytes, " << placedCells.size() << " mushrooms loaded"
+              << std::endl;
+    check(countMismatches(loaded, expected) == 0, "loaded world holds the same cells");
+    check(loaded.count() == expectedCount, "loaded world has the same count()");
+    check(hashWorld(loaded) == hashWorld(world), "loaded world has the same state checksum");
+
+    if (failures > 0) {
+        std::cout << "[check_world_streaming] " << failures << " checks failed" << std::endl;
+        return 1;
+    }
+    std::cout << "[check_world_streaming] All checks passed" << std::endl;
+    return 0;
+}
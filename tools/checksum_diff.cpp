@@ -0,0 +1,185 @@
+/**
+ * @file checksum_diff.cpp
+ * @author Ian Codding II
+ * @brief Compare two state checksum logs (--checksum) and find where they split
+ * @version 1.0
+ * @date 2025-12-20
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Usage: bin/checksum_diff A.log B.log     (build with: make checksum-diff)
+ *
+ * Walks both logs tick by tick and reports the first tick whose hash
+ * differs, with every entity whose hash differs or that only one run has.
+ * Also reports the first tick where the runs were fed different input
+ * (dt or buttons), since a split after that is expected.
+ *
+ * Exit code: 0 same, 1 the runs split, 2 bad arguments or unreadable log.
+ */
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const std::size_t MAX_REPORTED = 20;   // Entity lines printed at the split
+
+/**
+ * @brief One tick of a log: the header line and its entity lines
+ */
+struct Tick {
+    std::uint64_t number = 0;
+    std::string dt, input, hash;
+    std::vector<std::pair<std::string, std::string>> entities;   // "segment 2.7" -> hash
+};
+
+/**
+ * @brief Reads a log one tick at a time
+ */
+class LogReader {
+public:
+    explicit LogReader(const std::string& path) : file(path), path(path) {}
+
+    bool isOpen() const { return file.is_open(); }
+
+    /**
+     * @brief Next tick, false at the end of the log
+     */
+    bool next(Tick& tick) {
+        if (!readHeader(tick)) {
+            return false;
+        }
+        tick.entities.clear();
+        while (std::getline(file, line)) {
+            if (line.compare(0, 2, "  ") != 0) {
+                pending = true;   // Next tick's header
+                break;
+            }
+            std::size_t split = line.find_last_of(' ');
+            tick.entities.emplace_back(line.substr(2, split - 2), line.substr(split + 1));
+        }
+        return true;
+    }
+
+    const std::string& name() const { return path; }
+
+private:
+    bool readHeader(Tick& tick) {
+        if (!pending && !std::getline(file, line)) {
+            return false;
+        }
+        pending = false;
+
+        std::istringstream header(line);
+        std::string tickWord, dtWord, inputWord, hashWord;
+        header >> tickWord >> tick.number >> dtWord >> tick.dt >> inputWord >> tick.input >> hashWord >> tick.hash;
+        if (!header || tickWord != "tick") {
+            std::cerr << "[checksum_diff] " << path << ": not a checksum log line: " << line << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    std::ifstream file;
+    std::string path;
+    std::string line;
+    bool pending = false;
+};
+
+/**
+ * @brief Print the entities that differ between two ticks with different hashes
+ */
+void reportEntities(const Tick& a, const Tick& b) {
+    std::map<std::string, std::string> hashesB(b.entities.begin(), b.entities.end());
+    std::map<std::string, std::string> hashesA(a.entities.begin(), a.entities.end());
+    std::size_t reported = 0;
+    std::size_t differing = 0;
+
+    auto print = [&](const std::string& text) {
+        differing++;
+        if (reported < MAX_REPORTED) {
+            std::cout << "  " << text << std::endl;
+            reported++;
+        }
+    };
+
+    // In the order run A fed them, so the first line is the first entity to split
+    for (const auto& entity : a.entities) {
+        auto other = hashesB.find(entity.first);
+        if (other == hashesB.end()) {
+            print(entity.first + ": only in A");
+        } else if (other->second != entity.second) {
+            print(entity.first + ": " + entity.second + " vs " + other->second);
+        }
+    }
+    for (const auto& entity : b.entities) {
+        if (hashesA.find(entity.first) == hashesA.end()) {
+            print(entity.first + ": only in B");
+        }
+    }
+
+    if (differing == 0) {
+        std::cout << "  Same entities with the same hashes, fed in a different order" << std::endl;
+    } else if (differing > reported) {
+        std::cout << "  ... and " << differing - reported << " more" << std::endl;
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " A.log B.log" << std::endl;
+        return 2;
+    }
+
+    LogReader logA(argv[1]);
+    LogReader logB(argv[2]);
+    if (!logA.isOpen() || !logB.isOpen()) {
+        std::cerr << "[checksum_diff] Cannot open " << (logA.isOpen() ? argv[2] : argv[1]) << std::endl;
+        return 2;
+    }
+
+    Tick a, b;
+    std::uint64_t ticks = 0;
+    bool inputSplit = false;
+
+    while (true) {
+        bool haveA = logA.next(a);
+        bool haveB = logB.next(b);
+        if (!haveA || !haveB) {
+            std::cout << "[checksum_diff] Same state for " << ticks << " ticks";
+            if (haveA != haveB) {
+                std::cout << "; " << (haveA ? logB.name() : logA.name()) << " ends first";
+            }
+            std::cout << std::endl;
+            return 0;
+        }
+
+        if (a.number != b.number) {
+            std::cout << "[checksum_diff] Tick numbers differ: " << a.number << " vs " << b.number
+                      << " (logs from different sessions?)" << std::endl;
+            return 1;
+        }
+
+        if (!inputSplit && (a.dt != b.dt || a.input != b.input)) {
+            inputSplit = true;
+            std::cout << "[checksum_diff] Input differs from tick " << a.number << ": dt " << a.dt << " vs "
+                      << b.dt << ", buttons " << a.input << " vs " << b.input << std::endl;
+        }
+
+        if (a.hash != b.hash) {
+            std::cout << "[checksum_diff] First divergent tick: " << a.number << " (" << a.hash << " vs "
+                      << b.hash << ")" << (inputSplit ? ", after the input split" : "") << std::endl;
+            reportEntities(a, b);
+            return 1;
+        }
+        ticks++;
+    }
+}
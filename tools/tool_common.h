@@ -0,0 +1,75 @@
+/**
+ * @file tool_common.h
+ * @author Ian Codding II
+ * @brief Random numbers and timing shared by the check and benchmark tools
+ * @version 1.0
+ * @date 2025-12-23
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Header-only, so each tool still builds from its own .cpp plus the game
+ * sources it measures (see the bench and check-world targets in the
+ * makefile).
+ */
+
+#ifndef TOOL_COMMON_H
+#define TOOL_COMMON_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+namespace tools {
+
+/**
+ * @brief Small deterministic generator (LCG), so every run of a tool
+ *          builds the same world, boxes or queries
+ */
+class Random {
+public:
+    explicit Random(std::uint32_t seed) : state(seed) {}
+
+    /**
+     * @brief Integer in [0, limit)
+     */
+    int next(int limit) {
+        return static_cast<int>(bits() % static_cast<std::uint32_t>(limit));
+    }
+
+    /**
+     * @brief Float in [0, limit)
+     */
+    float next(float limit) {
+        return bits() * (limit / 16777216.0f);
+    }
+
+private:
+    // 24 high bits of the next state
+    std::uint32_t bits() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+
+    std::uint32_t state;
+};
+
+/**
+ * @brief Time run() several times and keep the fastest, which is the
+ *          one least disturbed by the rest of the machine
+ * @return Best run, in microseconds
+ */
+template <typename Run>
+double bestOfMicros(int runs, Run run) {
+    double best = 1e30;
+    for (int i = 0; i < runs; i++) {
+        auto start = std::chrono::steady_clock::now();
+        run();
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+} // namespace tools
+
+#endif // TOOL_COMMON_H